@@ -0,0 +1,84 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+import eagine.core;
+import eagine.sslplus;
+import std;
+
+#include "benchmark.hpp"
+
+namespace eagine {
+//------------------------------------------------------------------------------
+void benchmark_key(
+  main_ctx& ctx,
+  const sslplus::ssl_api& ssl,
+  const string_view key_path,
+  const string_view key_kind) {
+    file_contents key_pem{key_path};
+    if(ok pky{ssl.parse_private_key(key_pem)}) {
+        const auto del_pky{ssl.delete_pkey.raii(pky)};
+
+        if(ok md{ssl.message_digest_sha256()}) {
+            std::array<byte, 256> msg{};
+            std::array<byte, 1024> sig{};
+            ssl.random_bytes(cover(msg));
+
+            const auto helper_sign{operations_per_second([&] {
+                return bool(
+                  ssl.sign_data_digest(view(msg), cover(sig), md, pky));
+            })};
+
+            const memory::const_block signature{
+              ssl.sign_data_digest(view(msg), cover(sig), md, pky)};
+            const auto helper_verify{operations_per_second([&] {
+                return ssl.verify_data_digest(view(msg), signature, md, pky);
+            })};
+
+            sslplus::data_signer signer{ssl, md, pky};
+            const auto signer_sign{operations_per_second([&] {
+                return bool(signer.sign(view(msg), cover(sig)));
+            })};
+
+            sslplus::data_verifier verifier{ssl, md, pky};
+            const auto verifier_verify{operations_per_second([&] {
+                return verifier.verify(view(msg), signature);
+            })};
+
+            ctx.cio()
+              .print(
+                identifier{"ssl"},
+                "${keyKind}: sign ${hlpSign}/s (helper) ${sgnSign}/s "
+                "(signer), verify ${hlpVrfy}/s (helper) ${vrfVrfy}/s "
+                "(verifier)")
+              .arg(identifier{"keyKind"}, key_kind)
+              .arg(identifier{"hlpSign"}, helper_sign)
+              .arg(identifier{"sgnSign"}, signer_sign)
+              .arg(identifier{"hlpVrfy"}, helper_verify)
+              .arg(identifier{"vrfVrfy"}, verifier_verify);
+        }
+    } else {
+        ctx.log()
+          .error("failed to load key ${keyPath}")
+          .arg(identifier{"keyPath"}, identifier{"FsPath"}, key_path);
+    }
+}
+//------------------------------------------------------------------------------
+auto main(main_ctx& ctx) -> int {
+    const sslplus::ssl_api ssl{ctx};
+
+    benchmark_key(ctx, ssl, "rsa2048.key", "RSA-2048");
+    benchmark_key(ctx, ssl, "p256.key", "P-256");
+    benchmark_key(ctx, ssl, "ed25519.key", "Ed25519");
+
+    return 0;
+}
+//------------------------------------------------------------------------------
+} // namespace eagine
+
+auto main(int argc, const char** argv) -> int {
+    return eagine::default_main(argc, argv, eagine::main);
+}
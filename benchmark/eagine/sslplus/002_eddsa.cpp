@@ -0,0 +1,80 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+import eagine.core;
+import eagine.sslplus;
+import std;
+
+#include "benchmark.hpp"
+
+namespace eagine {
+//------------------------------------------------------------------------------
+void benchmark_key(
+  main_ctx& ctx,
+  const sslplus::ssl_api& ssl,
+  const sslplus::message_digest_type md,
+  const string_view key_path,
+  const string_view key_kind) {
+    file_contents key_pem{key_path};
+    if(ok pky{ssl.parse_private_key(key_pem)}) {
+        const auto del_pky{ssl.delete_pkey.raii(pky)};
+
+        for(const span_size_t msg_size : {32, 256, 4096}) {
+            std::vector<byte> msg(std_size(msg_size));
+            std::array<byte, 256> sig{};
+            ssl.random_bytes(cover(msg));
+
+            const memory::const_block signature{
+              ssl.sign_data_digest(view(msg), cover(sig), md, pky)};
+            if(not signature) {
+                ctx.log()
+                  .error("failed to sign data with ${keyKind} key")
+                  .arg(identifier{"keyKind"}, key_kind);
+                return;
+            }
+
+            const auto sign_rate{operations_per_second([&] {
+                return bool(
+                  ssl.sign_data_digest(view(msg), cover(sig), md, pky));
+            })};
+            const auto verify_rate{operations_per_second([&] {
+                return ssl.verify_data_digest(view(msg), signature, md, pky);
+            })};
+
+            ctx.cio()
+              .print(
+                identifier{"ssl"},
+                "${keyKind}, ${msgSize} byte message: sign ${sign}/s, "
+                "verify ${verify}/s")
+              .arg(identifier{"keyKind"}, key_kind)
+              .arg(identifier{"msgSize"}, identifier{"ByteSize"}, msg_size)
+              .arg(identifier{"sign"}, sign_rate)
+              .arg(identifier{"verify"}, verify_rate);
+        }
+    } else {
+        ctx.log()
+          .error("failed to load key ${keyPath}")
+          .arg(identifier{"keyPath"}, identifier{"FsPath"}, key_path);
+    }
+}
+//------------------------------------------------------------------------------
+auto main(main_ctx& ctx) -> int {
+    const sslplus::ssl_api ssl{ctx};
+
+    if(ok md{ssl.message_digest_sha256()}) {
+        benchmark_key(ctx, ssl, md, "ed25519.key", "Ed25519");
+        benchmark_key(ctx, ssl, md, "p256.key", "ECDSA P-256");
+    }
+
+    return 0;
+}
+//------------------------------------------------------------------------------
+} // namespace eagine
+
+auto main(int argc, const char** argv) -> int {
+    return eagine::default_main(argc, argv, eagine::main);
+}
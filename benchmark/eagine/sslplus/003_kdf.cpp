@@ -0,0 +1,107 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+import eagine.core;
+import eagine.sslplus;
+import std;
+
+#include "benchmark.hpp"
+
+namespace eagine {
+//------------------------------------------------------------------------------
+template <typename Function>
+auto derivations_per_second(Function func) -> float {
+    // the derivations are slow, so the budget is checked after each one
+    return operations_per_second(std::move(func), std::chrono::seconds{1}, 1);
+}
+//------------------------------------------------------------------------------
+void report(main_ctx& ctx, const string_view config, const float rate) {
+    if(rate > 0.F) {
+        ctx.cio()
+          .print(identifier{"ssl"}, "${config}: ${rate} derivations/s")
+          .arg(identifier{"config"}, config)
+          .arg(identifier{"rate"}, rate);
+    } else {
+        ctx.cio()
+          .print(identifier{"ssl"}, "${config}: not available")
+          .arg(identifier{"config"}, config);
+    }
+}
+//------------------------------------------------------------------------------
+auto main(main_ctx& ctx) -> int {
+    const sslplus::ssl_api ssl{ctx};
+
+    std::array<byte, 32> secret{};
+    std::array<byte, 16> salt{};
+    std::array<byte, 32> key{};
+    ssl.random_bytes(cover(secret));
+    ssl.random_bytes(cover(salt));
+
+    sslplus::hkdf hkdf{ssl};
+    report(ctx, "HKDF-SHA256", derivations_per_second([&] {
+               return not hkdf
+                            .derive(
+                              {.key = view(secret),
+                               .salt = view(salt),
+                               .info = view(salt)},
+                              cover(key))
+                            .empty();
+           }));
+
+    sslplus::pbkdf2 pbkdf2{ssl};
+    for(const std::uint64_t iterations : {10000U, 100000U, 600000U}) {
+        const std::string config{
+          "PBKDF2-SHA256 iter=" + std::to_string(iterations)};
+        report(ctx, config, derivations_per_second([&] {
+                   return not pbkdf2
+                                .derive(
+                                  {.password = view(secret),
+                                   .salt = view(salt),
+                                   .iterations = iterations},
+                                  cover(key))
+                                .empty();
+               }));
+    }
+
+    sslplus::scrypt scrypt{ssl};
+    for(const unsigned log2n : {14U, 15U, 17U}) {
+        const std::string config{"scrypt N=2^" + std::to_string(log2n)};
+        report(ctx, config, derivations_per_second([&] {
+                   return not scrypt
+                                .derive(
+                                  {.password = view(secret),
+                                   .salt = view(salt),
+                                   .cost = std::uint64_t(1U) << log2n,
+                                   .max_memory = std::uint64_t(1U) << 30U},
+                                  cover(key))
+                                .empty();
+               }));
+    }
+
+    sslplus::argon2 argon2{ssl};
+    for(const std::uint32_t threads : {1U, 4U}) {
+        const std::string config{
+          "Argon2id t=3 m=64MiB lanes=4 threads=" + std::to_string(threads)};
+        report(ctx, config, derivations_per_second([&] {
+                   return not argon2
+                                .derive(
+                                  {.password = view(secret),
+                                   .salt = view(salt),
+                                   .threads = threads},
+                                  cover(key))
+                                .empty();
+               }));
+    }
+
+    return 0;
+}
+//------------------------------------------------------------------------------
+} // namespace eagine
+
+auto main(int argc, const char** argv) -> int {
+    return eagine::default_main(argc, argv, eagine::main);
+}
@@ -0,0 +1,92 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+import eagine.core;
+import eagine.sslplus;
+import std;
+
+#include "benchmark.hpp"
+
+namespace eagine {
+//------------------------------------------------------------------------------
+template <typename Function>
+auto items_per_second(const span_size_t per_call, Function func) -> float {
+    return float(per_call) * operations_per_second(std::move(func));
+}
+//------------------------------------------------------------------------------
+void report(main_ctx& ctx, const string_view what, const float rate) {
+    ctx.cio()
+      .print(identifier{"ssl"}, "${what}: ${rate}/s")
+      .arg(identifier{"what"}, what)
+      .arg(identifier{"rate"}, rate);
+}
+//------------------------------------------------------------------------------
+auto main(main_ctx& ctx) -> int {
+    const sslplus::ssl_api ssl{ctx};
+    sslplus::random_generator gen{ssl};
+
+    std::array<byte, 16> nonce{};
+    report(ctx, "16-byte nonce (RAND_bytes)", items_per_second(1, [&] {
+               return bool(ssl.random_bytes(cover(nonce)));
+           }));
+    report(ctx, "16-byte nonce (pooled)", items_per_second(1, [&] {
+               return sslplus::pooled_random_bytes(ssl, cover(nonce));
+           }));
+
+    std::uint64_t sink{0U};
+    report(ctx, "uniform_int(1, 6)", items_per_second(1, [&] {
+               sink += gen.uniform_int(1, 6);
+               return true;
+           }));
+
+    const auto naive_uuid{[&] {
+        std::array<byte, 16> rand{};
+        if(ssl.random_bytes(cover(rand))) {
+            rand[6] = (rand[6] & byte{0x0F}) | byte{0x40};
+            rand[8] = (rand[8] & byte{0x3F}) | byte{0x80};
+            sslplus::uuid_string uuid{};
+            std::size_t o{0U};
+            for(std::size_t i = 0; i < rand.size(); ++i) {
+                if(i == 4 or i == 6 or i == 8 or i == 10) {
+                    uuid[o++] = '-';
+                }
+                const auto b{unsigned(rand[i])};
+                uuid[o++] = "0123456789abcdef"[b >> 4U];
+                uuid[o++] = "0123456789abcdef"[b & 0x0FU];
+            }
+            sink += std::uint64_t(uuid[0]);
+            return true;
+        }
+        return false;
+    }};
+    report(ctx, "UUIDv4 (RAND_bytes per UUID)", items_per_second(1, naive_uuid));
+
+    for(const span_size_t batch : {1, 64, 1024}) {
+        std::vector<sslplus::uuid_string> uuids(std_size(batch));
+        const std::string what{"UUIDv4 (batch " + std::to_string(batch) + ")"};
+        report(ctx, what, items_per_second(batch, [&] {
+                   gen.fill_uuids(uuids);
+                   return true;
+               }));
+    }
+
+    for(const span_size_t batch : {1, 64, 1024}) {
+        const std::string what{
+          "32-byte token (batch " + std::to_string(batch) + ")"};
+        report(ctx, what, items_per_second(batch, [&] {
+                   return gen.make_tokens(batch, 32).size() == std_size(batch);
+               }));
+    }
+
+    return sink == 0U ? 1 : 0;
+}
+//------------------------------------------------------------------------------
+} // namespace eagine
+
+auto main(int argc, const char** argv) -> int {
+    return eagine::default_main(argc, argv, eagine::main);
+}
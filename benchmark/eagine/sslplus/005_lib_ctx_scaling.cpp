@@ -0,0 +1,106 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+import eagine.core;
+import eagine.sslplus;
+import std;
+
+#include "benchmark.hpp"
+
+namespace eagine {
+//------------------------------------------------------------------------------
+struct signing_work {
+    signing_work(const sslplus::ssl_api& s, const memory::const_block key_pem)
+      : ssl{s} {
+        if(ok parsed{ssl.parse_private_key(key_pem)}) {
+            pky = std::move(parsed.get());
+        }
+    }
+
+    signing_work(signing_work&&) noexcept = default;
+    signing_work(const signing_work&) = delete;
+    auto operator=(signing_work&&) = delete;
+    auto operator=(const signing_work&) = delete;
+
+    ~signing_work() noexcept {
+        if(pky) {
+            ssl.delete_pkey(std::move(pky));
+        }
+    }
+
+    auto operator()() noexcept -> bool {
+        if(ok md{ssl.message_digest_sha256()}) {
+            return pky and
+                   not ssl.sign_data_digest(view(msg), cover(sig), md, pky)
+                         .empty();
+        }
+        return false;
+    }
+
+    const sslplus::ssl_api& ssl;
+    sslplus::owned_pkey pky{};
+    std::array<byte, 256> msg{};
+    std::array<byte, 256> sig{};
+};
+//------------------------------------------------------------------------------
+auto main(main_ctx& ctx) -> int {
+    const sslplus::ssl_api ssl{ctx};
+    const file_contents key_pem{"p256.key"};
+
+    const auto make_hashing{[&] {
+        return [&ssl, msg = std::array<byte, 1024>{}]() mutable {
+            std::array<byte, 32> md{};
+            return not ssl.sha256_digest(view(msg), cover(md)).empty();
+        };
+    }};
+
+    // keys are loaded in each thread, so that they belong to its context
+    const auto make_signing{[&] {
+        return signing_work{ssl, key_pem};
+    }};
+
+    // powers of two and always the number of hardware threads
+    const auto max_threads{std::max(std::thread::hardware_concurrency(), 1U)};
+    std::vector<unsigned> thread_counts;
+    for(unsigned threads = 1; threads < max_threads; threads *= 2) {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(max_threads);
+
+    for(const unsigned threads : thread_counts) {
+        const auto shared_hash{
+          parallel_operations_per_second(threads, nullptr, make_hashing)};
+        const auto shared_sign{
+          parallel_operations_per_second(threads, nullptr, make_signing)};
+
+        sslplus::library_context_manager contexts{ssl};
+        const auto own_hash{
+          parallel_operations_per_second(threads, &contexts, make_hashing)};
+        const auto own_sign{
+          parallel_operations_per_second(threads, &contexts, make_signing)};
+
+        ctx.cio()
+          .print(
+            identifier{"ssl"},
+            "${threads} threads: SHA-256 ${shHash}/s (shared) ${ownHash}/s "
+            "(per-thread), P-256 sign ${shSign}/s (shared) ${ownSign}/s "
+            "(per-thread)")
+          .arg(identifier{"threads"}, threads)
+          .arg(identifier{"shHash"}, shared_hash)
+          .arg(identifier{"ownHash"}, own_hash)
+          .arg(identifier{"shSign"}, shared_sign)
+          .arg(identifier{"ownSign"}, own_sign);
+    }
+
+    return 0;
+}
+//------------------------------------------------------------------------------
+} // namespace eagine
+
+auto main(int argc, const char** argv) -> int {
+    return eagine::default_main(argc, argv, eagine::main);
+}
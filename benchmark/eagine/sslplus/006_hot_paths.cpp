@@ -0,0 +1,225 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+import eagine.core;
+import eagine.sslplus;
+import std;
+
+#include "benchmark.hpp"
+
+namespace eagine {
+//------------------------------------------------------------------------------
+void benchmark_digests(benchmark_suite& suite, const sslplus::ssl_api& ssl) {
+    if(ok md{ssl.message_digest_sha256()}) {
+        for(const span_size_t size : {64, 1024, 16 * 1024, 1024 * 1024}) {
+            std::vector<byte> data(std_size(size));
+            std::array<byte, 64> dst{};
+            suite.run("data_digest_sha256", std::to_string(size), size, [&] {
+                return not ssl.data_digest(view(data), cover(dst), md).empty();
+            });
+        }
+    }
+}
+//------------------------------------------------------------------------------
+void benchmark_key(
+  benchmark_suite& suite,
+  const sslplus::ssl_api& ssl,
+  const string_view key_path,
+  const string_view key_kind) {
+    file_contents key_pem{key_path};
+    suite.run("parse_private_key", key_kind, 0, [&] {
+        if(ok pky{ssl.parse_private_key(key_pem)}) {
+            ssl.delete_pkey(std::move(pky.get()));
+            return true;
+        }
+        return false;
+    });
+
+    sslplus::key_cache keys{ssl};
+    suite.run("cached_private_key", key_kind, 0, [&] {
+        if(auto pky{keys.get(key_pem)}) {
+            ssl.delete_pkey(std::move(pky));
+            return true;
+        }
+        return false;
+    });
+
+    if(ok pky{ssl.parse_private_key(key_pem)}) {
+        const auto del_pky{ssl.delete_pkey.raii(pky)};
+
+        if(ok md{ssl.message_digest_sha256()}) {
+            std::array<byte, 256> msg{};
+            std::array<byte, 1024> sig{};
+            suite.run("sign_data_digest", key_kind, 0, [&] {
+                return not ssl.sign_data_digest(view(msg), cover(sig), md, pky)
+                             .empty();
+            });
+
+            const memory::const_block signature{
+              ssl.sign_data_digest(view(msg), cover(sig), md, pky)};
+            suite.run("verify_data_digest", key_kind, 0, [&] {
+                return ssl.verify_data_digest(view(msg), signature, md, pky);
+            });
+        }
+    }
+}
+//------------------------------------------------------------------------------
+void benchmark_certificates(
+  benchmark_suite& suite,
+  const sslplus::ssl_api& ssl) {
+    file_contents ca_cert_pem{"example-ca.crt"};
+    file_contents cert_pem{"example.crt"};
+
+    suite.run("parse_x509", "example.crt", 0, [&] {
+        if(ok cert{ssl.parse_x509(cert_pem)}) {
+            ssl.delete_x509(std::move(cert.get()));
+            return true;
+        }
+        return false;
+    });
+
+    if(ok ca_cert{ssl.parse_x509(ca_cert_pem)}) {
+        const auto del_ca_cert{ssl.delete_x509.raii(ca_cert)};
+        if(ok cert{ssl.parse_x509(cert_pem)}) {
+            const auto del_cert{ssl.delete_x509.raii(cert)};
+
+            suite.run("ca_verify_certificate", "example.crt", 0, [&] {
+                return ssl.ca_verify_certificate(ca_cert, cert);
+            });
+
+            suite.run("find_subject_name_entry", "api", 0, [&] {
+                return not ssl
+                             .find_certificate_subject_name_entry(
+                               cert, "organizationName")
+                             .empty();
+            });
+
+            sslplus::spki_pin_set pins{ssl};
+            pins.reserve(10000);
+            for(int i = 0; i < 9999; ++i) {
+                sslplus::spki_sha256 pin{};
+                ssl.random_bytes(cover(pin));
+                pins.add(pin);
+            }
+            pins.add(ca_cert);
+            suite.run("spki_pin_set_matches", "10000", 0, [&] {
+                return pins.matches(ca_cert);
+            });
+
+            sslplus::certificate_info_cache infos;
+            suite.run("find_subject_name_entry", "certificate_info", 0, [&] {
+                return not infos.get(cert)
+                             ->subject()
+                             .find("organizationName")
+                             .empty();
+            });
+        }
+    }
+}
+//------------------------------------------------------------------------------
+void benchmark_random(benchmark_suite& suite, const sslplus::ssl_api& ssl) {
+    for(const span_size_t size : {16, 4096}) {
+        std::vector<byte> dst(std_size(size));
+        suite.run("random_bytes", std::to_string(size), size, [&] {
+            return bool(ssl.random_bytes(cover(dst)));
+        });
+        suite.run("pooled_random_bytes", std::to_string(size), size, [&] {
+            return sslplus::pooled_random_bytes(ssl, cover(dst));
+        });
+    }
+}
+//------------------------------------------------------------------------------
+void benchmark_secure_memory(
+  benchmark_suite& suite,
+  const sslplus::ssl_api& ssl) {
+    // locks the pages once, instead of on each allocation
+    ssl.init_secure_heap(std::size_t(1U) << 20U, 16U);
+    for(const span_size_t size : {32, 4096}) {
+        suite.run("secure_block", std::to_string(size), size, [&] {
+            const sslplus::secure_block blk{size};
+            return bool(blk);
+        });
+    }
+}
+//------------------------------------------------------------------------------
+void benchmark_cipher(
+  benchmark_suite& suite,
+  const sslplus::ssl_api& ssl,
+  const sslplus::cipher_type type,
+  const string_view type_name) {
+    if(ok cip{ssl.new_cipher()}) {
+        const auto del_cip{ssl.delete_cipher.raii(cip)};
+
+        std::array<byte, 32> key{};
+        std::array<byte, 16> iv{};
+        if(ssl.cipher_init(cip, type, view(key), view(iv), true)) {
+            for(const span_size_t size : {1024, 16 * 1024}) {
+                std::vector<byte> src(std_size(size));
+                std::vector<byte> dst(std_size(size + 64));
+                const std::string param{
+                  to_string(type_name) + '/' + std::to_string(size)};
+                suite.run("cipher_update", param, size, [&] {
+                    return bool(ssl.cipher_update(
+                      cip, memory::split_block{cover(dst)}, view(src)));
+                });
+            }
+        }
+    }
+}
+//------------------------------------------------------------------------------
+auto main(main_ctx& ctx) -> int {
+    const sslplus::ssl_api ssl{ctx};
+
+    std::chrono::milliseconds budget{1000};
+    if(const auto arg{ctx.args().find("--budget-ms").next()}) {
+        if(const auto value{from_string<int>(string_view{arg})}) {
+            budget = std::chrono::milliseconds{*value};
+        }
+    }
+
+    benchmark_suite suite{budget};
+    benchmark_digests(suite, ssl);
+    benchmark_key(suite, ssl, "rsa2048.key", "RSA-2048");
+    benchmark_key(suite, ssl, "p256.key", "P-256");
+    benchmark_key(suite, ssl, "ed25519.key", "Ed25519");
+    benchmark_certificates(suite, ssl);
+    benchmark_random(suite, ssl);
+    benchmark_secure_memory(suite, ssl);
+    if(ok type{ssl.cipher_aes_128_gcm()}) {
+        benchmark_cipher(suite, ssl, type, "AES-128-GCM");
+    }
+    if(ok type{ssl.cipher_aes_128_ctr()}) {
+        benchmark_cipher(suite, ssl, type, "AES-128-CTR");
+    }
+    if(ok type{ssl.cipher_aes_192_cbc()}) {
+        benchmark_cipher(suite, ssl, type, "AES-192-CBC");
+    }
+
+    string_view format{"csv"};
+    if(const auto arg{ctx.args().find("--format").next()}) {
+        format = arg;
+    }
+    std::ofstream output_file;
+    if(const auto arg{ctx.args().find("--output").next()}) {
+        output_file.open(to_string(string_view{arg}));
+    }
+    std::ostream& out{output_file.is_open() ? output_file : std::cout};
+
+    if(format == "json") {
+        suite.write_json(out);
+    } else {
+        suite.write_csv(out);
+    }
+
+    return 0;
+}
+//------------------------------------------------------------------------------
+} // namespace eagine
+
+auto main(int argc, const char** argv) -> int {
+    return eagine::default_main(argc, argv, eagine::main);
+}
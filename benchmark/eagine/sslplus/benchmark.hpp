@@ -0,0 +1,156 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+#ifndef EAGINE_SSLPLUS_BENCHMARK_HPP
+#define EAGINE_SSLPLUS_BENCHMARK_HPP
+
+// included after importing std, eagine.core and eagine.sslplus
+
+namespace eagine {
+//------------------------------------------------------------------------------
+/// @brief Calls func in rounds of round_size calls until the deadline.
+/// @return The number of calls, or nothing if some call failed.
+template <typename Function>
+auto call_until(
+  const std::chrono::steady_clock::time_point deadline,
+  const int round_size,
+  Function& func) -> std::optional<span_size_t> {
+    span_size_t count{0};
+    while(true) {
+        for(int i = 0; i < round_size; ++i) {
+            if(not func()) {
+                return {};
+            }
+        }
+        count += round_size;
+        if(std::chrono::steady_clock::now() >= deadline) {
+            return count;
+        }
+    }
+}
+//------------------------------------------------------------------------------
+/// @brief Returns how many times per second func can be called.
+/// @param round_size the number of calls between checks of the time budget.
+/// @return Zero if some call failed.
+template <typename Function>
+auto operations_per_second(
+  Function func,
+  const std::chrono::milliseconds budget = std::chrono::seconds{1},
+  const int round_size = 16) -> float {
+    using clock = std::chrono::steady_clock;
+    const auto start{clock::now()};
+    if(const auto count{call_until(start + budget, round_size, func)}) {
+        const std::chrono::duration<float> elapsed{clock::now() - start};
+        return float(*count) / elapsed.count();
+    }
+    return 0.F;
+}
+//------------------------------------------------------------------------------
+/// @brief Returns how many times per second the functions made by make_func
+/// can be called in total on the specified number of threads.
+/// @param contexts if not null, each thread enters its own library context.
+/// @return Zero if some call failed.
+///
+/// The time is measured from the moment when all threads entered their
+/// context and made their function, so the setup is not counted.
+template <typename MakeFunction>
+auto parallel_operations_per_second(
+  const unsigned thread_count,
+  sslplus::library_context_manager* contexts,
+  MakeFunction make_func,
+  const std::chrono::milliseconds budget = std::chrono::seconds{1}) -> float {
+    using clock = std::chrono::steady_clock;
+    std::atomic<span_size_t> total{0};
+    std::atomic<bool> failed{false};
+    clock::time_point start{};
+    std::barrier ready{
+      std::ptrdiff_t(thread_count), [&]() noexcept { start = clock::now(); }};
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count);
+    for(unsigned t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&] {
+            if(contexts) {
+                contexts->enter();
+            }
+            {
+                auto func{make_func()};
+                ready.arrive_and_wait();
+                if(const auto count{call_until(start + budget, 16, func)}) {
+                    total += *count;
+                } else {
+                    failed = true;
+                }
+            }
+            if(contexts) {
+                contexts->leave();
+            }
+        });
+    }
+    for(auto& thread : threads) {
+        thread.join();
+    }
+    const std::chrono::duration<float> elapsed{clock::now() - start};
+    return failed ? 0.F : float(total.load()) / elapsed.count();
+}
+//------------------------------------------------------------------------------
+/// @brief The rates measured by a single benchmark_suite run.
+struct benchmark_result {
+    std::string name;
+    std::string parameter;
+    float operations_per_second{0.F};
+    float bytes_per_second{0.F};
+};
+//------------------------------------------------------------------------------
+/// @brief Collects the results of named benchmarks and writes them as a table.
+class benchmark_suite {
+public:
+    benchmark_suite(const std::chrono::milliseconds budget) noexcept
+      : _budget{budget} {}
+
+    template <typename Function>
+    void run(
+      const string_view name,
+      const string_view parameter,
+      const span_size_t bytes_per_operation,
+      Function func) {
+        const auto rate{operations_per_second(std::move(func), _budget)};
+        _results.push_back(
+          {.name = to_string(name),
+           .parameter = to_string(parameter),
+           .operations_per_second = rate,
+           .bytes_per_second = rate * float(bytes_per_operation)});
+    }
+
+    void write_csv(std::ostream& out) const {
+        out << "benchmark,parameter,ops_per_second,bytes_per_second\n";
+        for(const auto& r : _results) {
+            out << r.name << ',' << r.parameter << ','
+                << r.operations_per_second << ',' << r.bytes_per_second << '\n';
+        }
+    }
+
+    void write_json(std::ostream& out) const {
+        out << "[\n";
+        for(std::size_t i = 0; i < _results.size(); ++i) {
+            const auto& r{_results[i]};
+            out << "  {\"benchmark\": \"" << r.name << "\", \"parameter\": \""
+                << r.parameter
+                << "\", \"ops_per_second\": " << r.operations_per_second
+                << ", \"bytes_per_second\": " << r.bytes_per_second << '}'
+                << (i + 1 < _results.size() ? ",\n" : "\n");
+        }
+        out << "]\n";
+    }
+
+private:
+    std::chrono::milliseconds _budget;
+    std::vector<benchmark_result> _results;
+};
+//------------------------------------------------------------------------------
+} // namespace eagine
+
+#endif // EAGINE_SSLPLUS_BENCHMARK_HPP
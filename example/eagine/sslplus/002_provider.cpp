@@ -28,6 +28,25 @@ auto main(main_ctx& ctx) -> int {
           .arg("name", provider_name);
     }
 
+    if(ctx.args().find("--warm-up")) {
+        sslplus::warm_up_options opts;
+        opts.providers = {to_string(provider_name)};
+        const auto report{ssl.warm_up(opts)};
+        for(const auto& step : report.steps) {
+            ctx.cio()
+              .print(
+                identifier{"ssl"},
+                "${kind} ${name}: ${status} in ${duration}")
+              .arg(identifier{"kind"}, step.kind)
+              .arg(identifier{"name"}, step.name)
+              .arg(identifier{"status"}, step.succeeded ? "ok" : "failed")
+              .arg(identifier{"duration"}, step.duration);
+        }
+        for(const auto prov : report.providers) {
+            ssl.unload_provider(prov);
+        }
+    }
+
     return 0;
 }
 //------------------------------------------------------------------------------
@@ -14,7 +14,7 @@ namespace eagine {
 auto main(main_ctx& ctx) -> int {
     const auto& log = ctx.log();
     file_contents data(ctx.exe_path());
-    std::array<byte, 1024> temp{};
+    memory::buffer temp;
 
     string_view engine_id("pkcs11");
     if(const auto arg{ctx.args().find("--engine").next()}) {
@@ -43,7 +43,7 @@ auto main(main_ctx& ctx) -> int {
                 if(ok md{ssl.message_digest_sha256()}) {
 
                     if(const auto sig{
-                         ssl.sign_data_digest(data, cover(temp), md, pkey)}) {
+                         ssl.sign_data_digest(data, temp, md, pkey)}) {
 
                         ctx.cio()
                           .print(identifier{"ssl"}, "signature of self (${size})")
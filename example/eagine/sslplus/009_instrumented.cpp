@@ -0,0 +1,44 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+import eagine.core;
+import eagine.sslplus;
+import std;
+
+namespace eagine {
+//------------------------------------------------------------------------------
+auto main(main_ctx& ctx) -> int {
+    const sslplus::basic_ssl_api<sslplus::instrumented_ssl_api_traits> ssl{
+      ctx};
+    file_contents data(ctx.exe_path());
+
+    std::array<byte, 64> md{};
+    for(int i = 0; i < 100; ++i) {
+        ssl.sha256_digest(data, cover(md));
+    }
+
+    if(auto pkey{ssl.generate_key("ED25519")}) {
+        memory::buffer sig;
+        for(int i = 0; i < 100; ++i) {
+            if(const auto signature{ssl.sign_data_digest(
+                 data, sig, sslplus::message_digest_type{}, pkey)}) {
+                ssl.verify_data_digest(
+                  data, signature, sslplus::message_digest_type{}, pkey);
+            }
+        }
+        ssl.delete_pkey(std::move(pkey));
+    }
+
+    sslplus::log_call_statistics(ssl);
+    return 0;
+}
+//------------------------------------------------------------------------------
+} // namespace eagine
+
+auto main(int argc, const char** argv) -> int {
+    return eagine::default_main(argc, argv, eagine::main);
+}
@@ -0,0 +1,94 @@
+/// @example eagine/sslplus/010_bulk_verify.cpp
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+import eagine.core;
+import eagine.sslplus;
+import std;
+
+namespace eagine {
+//------------------------------------------------------------------------------
+auto main(main_ctx& ctx) -> int {
+    string_view ca_cert_path{"example-ca.crt"};
+    if(const auto arg{ctx.args().find("--ca-cert").next()}) {
+        ca_cert_path = arg;
+    }
+
+    // one certificate path per line, or the example certificate
+    std::vector<std::string> cert_paths;
+    if(const auto arg{ctx.args().find("--list").next()}) {
+        std::ifstream list{to_string(string_view{arg})};
+        std::string line;
+        while(std::getline(list, line)) {
+            if(not line.empty()) {
+                cert_paths.push_back(line);
+            }
+        }
+    } else {
+        cert_paths.emplace_back("example.crt");
+    }
+
+    const sslplus::ssl_api ssl{ctx};
+
+    if(ok store{ssl.new_x509_store()}) {
+        const auto del_store{ssl.delete_x509_store.raii(store)};
+
+        if(ssl.load_into_x509_store(store, ca_cert_path)) {
+            sslplus::bulk_verifier verifier{ssl, store};
+
+            span_size_t verified{0};
+            span_size_t failed{0};
+            const auto count{verifier.verify(
+              cert_paths | std::views::transform([](const std::string& path) {
+                  return file_contents{path};
+              }),
+              [&](const sslplus::bulk_verification_result& result) {
+                  if(result) {
+                      ++verified;
+                      return;
+                  }
+                  ++failed;
+                  const auto& path{cert_paths[std_size(result.index)]};
+                  if(result.parsed) {
+                      ctx.log()
+                        .error("failed to verify certificate ${certPath}: ${reason}")
+                        .arg(identifier{"certPath"}, identifier{"FsPath"}, path)
+                        .arg(identifier{"depth"}, result.error_depth)
+                        .arg(
+                          identifier{"reason"},
+                          ssl.x509_verify_error_string(result.error)
+                            .value_or("unknown"));
+                  } else {
+                      ctx.log()
+                        .error("failed to load certificate ${certPath}")
+                        .arg(identifier{"certPath"}, identifier{"FsPath"}, path);
+                  }
+              })};
+
+            ctx.cio()
+              .print(
+                identifier{"ssl"},
+                "verified ${verified} of ${count} certificates, ${failed} "
+                "failed, ${interm} distinct intermediates")
+              .arg(identifier{"verified"}, verified)
+              .arg(identifier{"count"}, count)
+              .arg(identifier{"failed"}, failed)
+              .arg(identifier{"interm"}, verifier.intermediate_count());
+        } else {
+            ctx.log()
+              .error("failed to load CA certificate ${certPath}")
+              .arg(identifier{"certPath"}, identifier{"FsPath"}, ca_cert_path);
+        }
+    }
+
+    return 0;
+}
+//------------------------------------------------------------------------------
+} // namespace eagine
+
+auto main(int argc, const char** argv) -> int {
+    return eagine::default_main(argc, argv, eagine::main);
+}
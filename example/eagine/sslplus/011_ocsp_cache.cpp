@@ -0,0 +1,79 @@
+/// @example eagine/sslplus/011_ocsp_cache.cpp
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+import eagine.core;
+import eagine.sslplus;
+import std;
+
+namespace eagine {
+//------------------------------------------------------------------------------
+auto main(main_ctx& ctx) -> int {
+    string_view cert_path{"example.crt"};
+    if(const auto arg{ctx.args().find("--cert").next()}) {
+        cert_path = arg;
+    }
+
+    const sslplus::ssl_api ssl{ctx};
+
+    file_contents ca_cert_pem{"example-ca.crt"};
+    file_contents ca_key_pem{"example-ca.key"};
+    file_contents cert_pem{cert_path};
+
+    if(ok ca_cert{ssl.parse_x509(ca_cert_pem)}) {
+        const auto del_ca_cert{ssl.delete_x509.raii(ca_cert)};
+
+        if(ok ca_key{ssl.parse_private_key(ca_key_pem)}) {
+            const auto del_ca_key{ssl.delete_pkey.raii(ca_key)};
+
+            if(ok cert{ssl.parse_x509(cert_pem)}) {
+                const auto del_cert{ssl.delete_x509.raii(cert)};
+
+                if(ok store{ssl.new_x509_store()}) {
+                    const auto del_store{ssl.delete_x509_store.raii(store)};
+                    ssl.add_cert_into_x509_store(store, ca_cert);
+
+                    // the CA answers the OCSP queries in-process
+                    sslplus::ocsp_local_responder responder{ca_cert, ca_key};
+                    sslplus::ocsp_cache cache{ssl, responder, store};
+
+                    for(int i = 0; i < 3; ++i) {
+                        const auto result{cache.check(cert, ca_cert)};
+                        ctx.cio()
+                          .print(
+                            identifier{"ssl"},
+                            "certificate ${certPath}: ${status} "
+                            "(cached: ${cached}, queries: ${queries})")
+                          .arg(
+                            identifier{"certPath"},
+                            identifier{"FsPath"},
+                            cert_path)
+                          .arg(
+                            identifier{"status"},
+                            ssl
+                              .ocsp_cert_status_string(
+                                static_cast<long>(result.status))
+                              .value_or("invalid"))
+                          .arg(identifier{"cached"}, result.cached)
+                          .arg(identifier{"queries"}, responder.query_count());
+                    }
+                }
+            } else {
+                ctx.log()
+                  .error("failed to load certificate ${certPath}")
+                  .arg(identifier{"certPath"}, identifier{"FsPath"}, cert_path);
+            }
+        }
+    }
+
+    return 0;
+}
+//------------------------------------------------------------------------------
+} // namespace eagine
+
+auto main(int argc, const char** argv) -> int {
+    return eagine::default_main(argc, argv, eagine::main);
+}
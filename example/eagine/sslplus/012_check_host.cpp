@@ -0,0 +1,77 @@
+/// @example eagine/sslplus/012_check_host.cpp
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+import eagine.core;
+import eagine.sslplus;
+import std;
+
+namespace eagine {
+//------------------------------------------------------------------------------
+auto main(main_ctx& ctx) -> int {
+    string_view cert_path{"example.crt"};
+    if(const auto arg{ctx.args().find("--cert").next()}) {
+        cert_path = arg;
+    }
+
+    // one host name or IP address per line, or a few examples
+    std::vector<std::string> hosts;
+    if(const auto arg{ctx.args().find("--hosts").next()}) {
+        std::ifstream list{to_string(string_view{arg})};
+        std::string line;
+        while(std::getline(list, line)) {
+            if(not line.empty()) {
+                hosts.push_back(line);
+            }
+        }
+    } else {
+        hosts = {"oglplus.org", "www.oglplus.org", "a.b.oglplus.org", "127.0.0.1"};
+    }
+
+    file_contents cert_pem{cert_path};
+    const sslplus::ssl_api ssl{ctx};
+
+    if(ok cert{ssl.parse_x509(cert_pem, {})}) {
+        const auto del_cert{ssl.delete_x509.raii(cert)};
+
+        // decoded only once for all the checked hosts
+        const sslplus::subject_alt_names names{cert};
+        names.for_each([&](auto, const std::string_view name) {
+            ctx.cio()
+              .print(identifier{"ssl"}, "alternative name: ${name}")
+              .arg(identifier{"name"}, string_view{name});
+        });
+
+        for(const auto& host_name : hosts) {
+            const string_view host{host_name};
+            const bool matches{
+              names.matches_ip_text(host) or names.matches_host(host)};
+            const bool checked{
+              ssl.check_x509_ip_string(cert, host, 0U) or
+              ssl.check_x509_host(
+                cert, host, ssl.x509_check_flag_no_partial_wildcards)};
+            ctx.cio()
+              .print(
+                identifier{"ssl"},
+                "${host}: ${matches} (pre-parsed), ${checked} (OpenSSL)")
+              .arg(identifier{"host"}, host)
+              .arg(identifier{"matches"}, matches)
+              .arg(identifier{"checked"}, checked);
+        }
+    } else {
+        ctx.log()
+          .error("failed to load certificate ${certPath}")
+          .arg(identifier{"certPath"}, identifier{"FsPath"}, cert_path);
+    }
+
+    return 0;
+}
+//------------------------------------------------------------------------------
+} // namespace eagine
+
+auto main(int argc, const char** argv) -> int {
+    return eagine::default_main(argc, argv, eagine::main);
+}
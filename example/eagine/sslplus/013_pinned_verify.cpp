@@ -0,0 +1,109 @@
+/// @example eagine/sslplus/013_pinned_verify.cpp
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+import eagine.core;
+import eagine.sslplus;
+import std;
+
+namespace eagine {
+//------------------------------------------------------------------------------
+auto main(main_ctx& ctx) -> int {
+    string_view ca_cert_path{"example-ca.crt"};
+    if(const auto arg{ctx.args().find("--ca-cert").next()}) {
+        ca_cert_path = arg;
+    }
+
+    string_view cert_path{"example.crt"};
+    if(const auto arg{ctx.args().find("--cert").next()}) {
+        cert_path = arg;
+    }
+
+    file_contents ca_cert_pem{ca_cert_path};
+    file_contents cert_pem{cert_path};
+    const sslplus::ssl_api ssl{ctx};
+
+    if(ok ca_cert{ssl.parse_x509(ca_cert_pem, {})}) {
+        const auto del_ca_cert{ssl.delete_x509.raii(ca_cert)};
+
+        if(ok cert{ssl.parse_x509(cert_pem, {})}) {
+            const auto del_cert{ssl.delete_x509.raii(cert)};
+
+            if(ok store{ssl.new_x509_store()}) {
+                const auto del_store{ssl.delete_x509_store.raii(store)};
+                ssl.add_cert_into_x509_store(store, ca_cert);
+
+                sslplus::spki_pin_set pins{ssl};
+                pins.add(ca_cert);
+
+                // the callback is invoked from the trust anchor to the leaf,
+                // require that some certificate in the chain is pinned
+                bool pinned{false};
+                auto pinning_policy{
+                  [&](
+                    const bool preverified,
+                    const sslplus::x509_store_ctx vrfy_ctx) noexcept -> bool {
+                      if(not preverified) {
+                          return false;
+                      }
+                      if(const auto current{
+                           ssl.get_x509_store_ctx_current_cert(vrfy_ctx)}) {
+                          pinned = pinned or pins.matches(*current);
+                      }
+                      const auto depth{
+                        ssl.get_x509_store_ctx_error_depth(vrfy_ctx)};
+                      if((depth.value_or(-1) == 0) and not pinned) {
+                          ssl.set_x509_store_ctx_error(
+                            vrfy_ctx, ssl.x509_v_err_application_verification);
+                          return false;
+                      }
+                      return true;
+                  }};
+                sslplus::verify_callback callback{
+                  {construct_from, pinning_policy}};
+
+                sslplus::chain_verifier verifier{ssl};
+                const auto result{verifier.verify_chain(
+                  store,
+                  cert,
+                  {.flags = ssl.x509_v_flag_no_check_time,
+                   .callback = &callback})};
+
+                if(result) {
+                    ctx.cio()
+                      .print(
+                        identifier{"ssl"},
+                        "verified pinned certificate ${certPath}")
+                      .arg(identifier{"certPath"}, identifier{"FsPath"}, cert_path);
+                } else {
+                    ctx.log()
+                      .error("failed to verify certificate ${certPath}: ${reason}")
+                      .arg(identifier{"certPath"}, identifier{"FsPath"}, cert_path)
+                      .arg(
+                        identifier{"reason"},
+                        ssl.x509_verify_error_string(result.error)
+                          .value_or("unknown"));
+                }
+            }
+        } else {
+            ctx.log()
+              .error("failed to load certificate ${certPath}")
+              .arg(identifier{"certPath"}, identifier{"FsPath"}, cert_path);
+        }
+    } else {
+        ctx.log()
+          .error("failed to load CA certificate ${certPath}")
+          .arg(identifier{"certPath"}, identifier{"FsPath"}, ca_cert_path);
+    }
+
+    return 0;
+}
+//------------------------------------------------------------------------------
+} // namespace eagine
+
+auto main(int argc, const char** argv) -> int {
+    return eagine::default_main(argc, argv, eagine::main);
+}
@@ -0,0 +1,77 @@
+/// @example eagine/sslplus/014_hash_dir_verify.cpp
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+import eagine.core;
+import eagine.sslplus;
+import std;
+
+namespace eagine {
+//------------------------------------------------------------------------------
+auto main(main_ctx& ctx) -> int {
+    // directory prepared with `openssl rehash`
+    string_view ca_dir{"/etc/ssl/certs"};
+    if(const auto arg{ctx.args().find("--ca-dir").next()}) {
+        ca_dir = arg;
+    }
+
+    string_view cert_path{"example.crt"};
+    if(const auto arg{ctx.args().find("--cert").next()}) {
+        cert_path = arg;
+    }
+
+    file_contents cert_pem{cert_path};
+    const sslplus::ssl_api ssl{ctx};
+
+    if(ok cert{ssl.parse_x509(cert_pem, {})}) {
+        const auto del_cert{ssl.delete_x509.raii(cert)};
+
+        if(ok store{ssl.new_x509_store()}) {
+            const auto del_store{ssl.delete_x509_store.raii(store)};
+
+            sslplus::issuer_cache issuers{
+              ssl, {std::string{ca_dir.data(), std_size(ca_dir.size())}}};
+            sslplus::chain_verifier verifier{ssl};
+            const sslplus::object_stack<sslplus::x509> intermediates;
+
+            for(int i = 0; i < 3; ++i) {
+                const auto result{issuers.verify_chain(
+                  verifier,
+                  store,
+                  cert,
+                  intermediates,
+                  {.flags = ssl.x509_v_flag_no_check_time})};
+                const auto stats{issuers.stats()};
+                ctx.cio()
+                  .print(
+                    identifier{"ssl"},
+                    "certificate ${certPath}: ${status} "
+                    "(hits: ${hits}, misses: ${misses}, loaded: ${loaded})")
+                  .arg(identifier{"certPath"}, identifier{"FsPath"}, cert_path)
+                  .arg(
+                    identifier{"status"},
+                    result ? string_view{"verified"}
+                           : ssl.x509_verify_error_string(result.error)
+                               .value_or("unknown"))
+                  .arg(identifier{"hits"}, stats.hits)
+                  .arg(identifier{"misses"}, stats.misses)
+                  .arg(identifier{"loaded"}, stats.loaded);
+            }
+        }
+    } else {
+        ctx.log()
+          .error("failed to load certificate ${certPath}")
+          .arg(identifier{"certPath"}, identifier{"FsPath"}, cert_path);
+    }
+
+    return 0;
+}
+//------------------------------------------------------------------------------
+} // namespace eagine
+
+auto main(int argc, const char** argv) -> int {
+    return eagine::default_main(argc, argv, eagine::main);
+}
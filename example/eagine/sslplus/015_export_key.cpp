@@ -0,0 +1,68 @@
+/// @example eagine/sslplus/015_export_key.cpp
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+import eagine.core;
+import eagine.sslplus;
+import std;
+
+namespace eagine {
+//------------------------------------------------------------------------------
+auto main(main_ctx& ctx) -> int {
+    string_view key_path{"example-ca.key"};
+    if(const auto arg{ctx.args().find("--key").next()}) {
+        key_path = arg;
+    }
+
+    string_view password{"example"};
+    if(const auto arg{ctx.args().find("--password").next()}) {
+        password = arg;
+    }
+
+    // scrypt for keys in cold storage, cheaper PBKDF2 for hot services
+    sslplus::private_key_encryption_params params{};
+    if(ctx.args().find("--scrypt")) {
+        params.kdf = sslplus::key_encryption_kdf::scrypt;
+        params.scrypt_n = 1U << 17U;
+    } else {
+        params.pbkdf2_iterations = 1000;
+    }
+
+    file_contents key_pem{key_path};
+    const sslplus::ssl_api ssl{ctx};
+
+    if(ok key{ssl.parse_private_key(key_pem)}) {
+        const auto del_key{ssl.delete_pkey.raii(key)};
+
+        sslplus::private_key_writer writer{ssl};
+        memory::buffer encrypted;
+        if(const auto pem{writer.write(key, password, encrypted, params)}) {
+            ctx.cio()
+              .print(identifier{"ssl"}, "encrypted key ${keyPath}:\n${pem}")
+              .arg(identifier{"keyPath"}, identifier{"FsPath"}, key_path)
+              .arg(
+                identifier{"pem"},
+                string_view{
+                  reinterpret_cast<const char*>(pem.data()), pem.size()});
+        } else {
+            ctx.log()
+              .error("failed to encrypt key ${keyPath}")
+              .arg(identifier{"keyPath"}, identifier{"FsPath"}, key_path);
+        }
+    } else {
+        ctx.log()
+          .error("failed to load key ${keyPath}")
+          .arg(identifier{"keyPath"}, identifier{"FsPath"}, key_path);
+    }
+
+    return 0;
+}
+//------------------------------------------------------------------------------
+} // namespace eagine
+
+auto main(int argc, const char** argv) -> int {
+    return eagine::default_main(argc, argv, eagine::main);
+}
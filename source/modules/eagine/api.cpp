@@ -48,10 +48,11 @@ private:
       const int writing,
       void* ptr) noexcept -> int {
         if(auto* self = static_cast<password_callback*>(ptr)) {
-            return self->_callback(
-                     memory::string_span(dst, span_size_t(len)), writing != 0)
-                     ? 1
-                     : 0;
+            if(self->_callback(
+                 memory::string_span(dst, span_size_t(len)), writing != 0)) {
+                // OpenSSL expects the length of the password written into dst
+                return static_cast<int>(std::find(dst, dst + len, '\0') - dst);
+            }
         }
         return 0;
     }
@@ -59,6 +60,41 @@ private:
     callable_ref<bool(const memory::string_span, const bool) noexcept>
       _callback{};
 };
+//------------------------------------------------------------------------------
+/// @brief Callback invoked for each certificate during chain verification.
+/// @see basic_ssl_api::set_verify_callback
+///
+/// The callable gets the result of the built-in checks and the store context
+/// and returns if the verification should continue. OpenSSL does not pass
+/// any user data to the callback, so the pointer to this object is passed
+/// via the store context ex-data slot reserved by ex_data_index().
+export class verify_callback {
+public:
+    constexpr verify_callback() noexcept = default;
+
+    constexpr verify_callback(
+      callable_ref<bool(const bool, const x509_store_ctx) noexcept>
+        callback) noexcept
+      : _callback{std::move(callback)} {}
+
+    constexpr auto native_func() noexcept -> auto* {
+        return _callback ? &_impl : nullptr;
+    }
+
+    constexpr auto native_data() noexcept -> auto* {
+        return _callback ? static_cast<void*>(this) : nullptr;
+    }
+
+    /// @brief Returns the X509_STORE_CTX ex-data index used by all callbacks.
+    static auto ex_data_index() noexcept -> int;
+
+private:
+    static auto _impl(
+      const int preverified,
+      ssl_types::x509_store_ctx_type* ctx) noexcept -> int;
+
+    callable_ref<bool(const bool, const x509_store_ctx) noexcept> _callback{};
+};
 } // namespace eagine::sslplus
 //------------------------------------------------------------------------------
 namespace eagine::c_api {
@@ -85,6 +121,23 @@ struct make_args_map<
           .native_data();
     }
 };
+
+export template <std::size_t CI, std::size_t CppI, typename... CT, typename... CppT>
+struct make_args_map<
+  CI,
+  CppI,
+  mp_list<int (*)(int, sslplus::ssl_types::x509_store_ctx_type*), CT...>,
+  mp_list<sslplus::verify_callback, CppT...>>
+  : make_args_map<CI + 1, CppI + 1, mp_list<CT...>, mp_list<CppT...>> {
+    using make_args_map<CI + 1, CppI + 1, mp_list<CT...>, mp_list<CppT...>>::
+    operator();
+
+    template <typename... P>
+    constexpr auto operator()(size_constant<CI> i, P&&... p) const noexcept {
+        return reorder_arg_map<CI, CppI>{}(i, std::forward<P>(p)...)
+          .native_func();
+    }
+};
 } // namespace eagine::c_api
 //------------------------------------------------------------------------------
 namespace eagine::sslplus {
@@ -125,9 +178,7 @@ public:
     simple_adapted_function<&ssl_api::lib_ctx_get_global_default, lib_ctx()>
       get_default_lib_ctx{*this};
 
-    simple_adapted_function<
-      &ssl_api::lib_ctx_get_global_default,
-      lib_ctx(lib_ctx)>
+    simple_adapted_function<&ssl_api::lib_ctx_set_default, lib_ctx(lib_ctx)>
       set_default_lib_ctx{*this};
 
     simple_adapted_function<
@@ -135,6 +186,58 @@ public:
       c_api::collapsed<int>(owned_lib_ctx)>
       delete_lib_ctx{*this};
 
+    simple_adapted_function<
+      &ssl_api::ossl_set_max_threads,
+      c_api::collapsed<int>(lib_ctx, std::uint64_t)>
+      set_max_threads{*this};
+
+    // params
+    simple_adapted_function<&ssl_api::param_bld_new, owned_param_builder()>
+      new_param_builder{*this};
+
+    simple_adapted_function<
+      &ssl_api::param_bld_free,
+      void(owned_param_builder)>
+      delete_param_builder{*this};
+
+    simple_adapted_function<
+      &ssl_api::param_bld_push_utf8_string,
+      c_api::collapsed<int>(param_builder, string_view, string_view)>
+      push_string_param{*this};
+
+    simple_adapted_function<
+      &ssl_api::param_bld_push_octet_string,
+      c_api::collapsed<int>(param_builder, string_view, memory::const_block)>
+      push_octets_param{*this};
+
+    simple_adapted_function<
+      &ssl_api::param_bld_push_uint32,
+      c_api::collapsed<int>(param_builder, string_view, std::uint32_t)>
+      push_uint32_param{*this};
+
+    simple_adapted_function<
+      &ssl_api::param_bld_push_uint64,
+      c_api::collapsed<int>(param_builder, string_view, std::uint64_t)>
+      push_uint64_param{*this};
+
+    simple_adapted_function<
+      &ssl_api::param_bld_to_param,
+      owned_param_list(param_builder)>
+      build_param_list{*this};
+
+    simple_adapted_function<&ssl_api::param_free, void(owned_param_list)>
+      delete_param_list{*this};
+
+    simple_adapted_function<
+      &ssl_api::param_locate,
+      param_list(param_list, string_view)>
+      locate_param{*this};
+
+    simple_adapted_function<
+      &ssl_api::param_get_octet_string_ptr,
+      c_api::collapsed<int>(param_list, const void*&, size_t&)>
+      get_param_octets_ptr{*this};
+
     simple_adapted_function<
       &ssl_api::provider_set_default_search_path,
       void(lib_ctx, string_view)>
@@ -164,7 +267,7 @@ public:
     simple_adapted_function<&ssl_api::provider_get_dispatch, dispatch(provider)>
       get_provider_dispatch{*this};
 
-    simple_adapted_function<&ssl_api::provider_get_dispatch, bool(provider)>
+    simple_adapted_function<&ssl_api::provider_self_test, bool(provider)>
       provider_self_test{*this};
 
     // ASN1
@@ -238,12 +341,103 @@ public:
       c_api::collapsed<int>(memory::block)>
       random_bytes{*this};
 
-    simple_adapted_function<&ssl_api::evp_pkey_up_ref, owned_pkey(pkey)>
+    simple_adapted_function<
+      &ssl_api::rand_priv_bytes,
+      c_api::collapsed<int>(memory::block)>
+      random_private_bytes{*this};
+
+    simple_adapted_function<
+      &ssl_api::rand_bytes_ex,
+      c_api::collapsed<int>(lib_ctx, memory::block, unsigned)>
+      random_bytes_ex{*this};
+
+    simple_adapted_function<
+      &ssl_api::rand_priv_bytes_ex,
+      c_api::collapsed<int>(lib_ctx, memory::block, unsigned)>
+      random_private_bytes_ex{*this};
+
+    simple_adapted_function<&ssl_api::openssl_cleanse, void(memory::block)>
+      cleanse_memory{*this};
+
+    simple_adapted_function<
+      &ssl_api::crypto_secure_malloc_init,
+      int(std::size_t, std::size_t)>
+      init_secure_heap{*this};
+
+    simple_adapted_function<&ssl_api::crypto_secure_malloc_initialized, int()>
+      is_secure_heap_initialized{*this};
+
+    simple_adapted_function<
+      &ssl_api::crypto_secure_malloc_done,
+      c_api::collapsed<int>()>
+      done_secure_heap{*this};
+
+    simple_adapted_function<&ssl_api::crypto_secure_used, std::size_t()>
+      secure_heap_used{*this};
+
+    adapted_function<
+      &ssl_api::evp_pkey_up_ref,
+      owned_pkey(pkey),
+      c_api::replaced_with_map<1>>
       copy_pkey{*this};
 
     simple_adapted_function<&ssl_api::evp_pkey_free, void(owned_pkey)>
       delete_pkey{*this};
 
+    simple_adapted_function<&ssl_api::evp_pkey_is_a, bool(pkey, string_view)>
+      pkey_is_a{*this};
+
+    simple_adapted_function<&ssl_api::evp_pkey_get_size, span_size_t(pkey)>
+      get_pkey_size{*this};
+
+    simple_adapted_function<
+      &ssl_api::evp_pkey_ctx_new,
+      owned_pkey_ctx(pkey, engine)>
+      new_pkey_ctx{*this};
+
+    simple_adapted_function<
+      &ssl_api::evp_pkey_ctx_new_from_name,
+      owned_pkey_ctx(lib_ctx, string_view, string_view)>
+      new_pkey_ctx_from_name{*this};
+
+    simple_adapted_function<&ssl_api::evp_pkey_ctx_free, void(owned_pkey_ctx)>
+      delete_pkey_ctx{*this};
+
+    simple_adapted_function<
+      &ssl_api::evp_pkey_keygen_init,
+      c_api::collapsed<int>(pkey_ctx)>
+      pkey_keygen_init{*this};
+
+    simple_adapted_function<
+      &ssl_api::evp_pkey_keygen,
+      c_api::returned<owned_pkey>(pkey_ctx, c_api::returned<owned_pkey>)>
+      pkey_keygen{*this};
+
+    simple_adapted_function<
+      &ssl_api::evp_pkey_ctx_set_rsa_keygen_bits,
+      c_api::collapsed<int>(pkey_ctx, int)>
+      set_pkey_rsa_keygen_bits{*this};
+
+    simple_adapted_function<
+      &ssl_api::evp_pkey_ctx_set_group_name,
+      c_api::collapsed<int>(pkey_ctx, string_view)>
+      set_pkey_group_name{*this};
+
+    simple_adapted_function<
+      &ssl_api::evp_pkey_derive_init,
+      c_api::collapsed<int>(pkey_ctx)>
+      pkey_derive_init{*this};
+
+    simple_adapted_function<
+      &ssl_api::evp_pkey_derive_set_peer,
+      c_api::collapsed<int>(pkey_ctx, pkey)>
+      pkey_derive_set_peer{*this};
+
+    simple_adapted_function<
+      &ssl_api::evp_pkey_derive,
+      c_api::collapsed<int>(pkey_ctx, memory::block, size_t&)>
+      pkey_derive{*this};
+
     simple_adapted_function<&ssl_api::evp_aes_128_ctr, cipher_type()>
       cipher_aes_128_ctr{*this};
 
@@ -262,6 +456,16 @@ public:
     simple_adapted_function<&ssl_api::evp_aes_192_cbc, cipher_type()>
       cipher_aes_192_cbc{*this};
 
+    simple_adapted_function<
+      &ssl_api::evp_cipher_fetch,
+      owned_cipher_algorithm(lib_ctx, string_view, string_view)>
+      fetch_cipher{*this};
+
+    simple_adapted_function<
+      &ssl_api::evp_cipher_free,
+      void(owned_cipher_algorithm)>
+      delete_cipher_algorithm{*this};
+
     simple_adapted_function<&ssl_api::evp_cipher_ctx_new, owned_cipher()>
       new_cipher{*this};
 
@@ -460,6 +664,16 @@ public:
     simple_adapted_function<&ssl_api::evp_sha512, message_digest_type()>
       message_digest_sha512{*this};
 
+    simple_adapted_function<
+      &ssl_api::evp_md_fetch,
+      owned_message_digest_algorithm(lib_ctx, string_view, string_view)>
+      fetch_message_digest{*this};
+
+    simple_adapted_function<
+      &ssl_api::evp_md_free,
+      void(owned_message_digest_algorithm)>
+      delete_message_digest_algorithm{*this};
+
     simple_adapted_function<
       &ssl_api::evp_md_size,
       span_size_t(message_digest_type)>
@@ -476,6 +690,11 @@ public:
       c_api::collapsed<int>(message_digest)>
       message_digest_reset{*this};
 
+    simple_adapted_function<
+      &ssl_api::evp_md_ctx_copy_ex,
+      c_api::collapsed<int>(message_digest, message_digest)>
+      copy_message_digest{*this};
+
     simple_adapted_function<
       &ssl_api::evp_digest_init,
       c_api::collapsed<int>(message_digest, message_digest_type)>
@@ -538,6 +757,12 @@ public:
         }
     } message_digest_sign_final{*this};
 
+    simple_adapted_function<
+      &ssl_api::evp_digest_sign,
+      c_api::collapsed<
+        int>(message_digest, memory::block, size_t&, memory::const_block)>
+      message_digest_sign{*this};
+
     simple_adapted_function<
       &ssl_api::evp_digest_verify_init,
       c_api::returned<pkey_ctx>(
@@ -558,6 +783,44 @@ public:
       c_api::collapsed<int>(message_digest, memory::const_block)>
       message_digest_verify_final{*this};
 
+    simple_adapted_function<
+      &ssl_api::evp_digest_verify,
+      c_api::collapsed<
+        int>(message_digest, memory::const_block, memory::const_block)>
+      message_digest_verify{*this};
+
+    // kdf
+    simple_adapted_function<
+      &ssl_api::evp_kdf_fetch,
+      owned_kdf(lib_ctx, string_view, string_view)>
+      fetch_kdf{*this};
+
+    simple_adapted_function<&ssl_api::evp_kdf_free, void(owned_kdf)>
+      delete_kdf{*this};
+
+    simple_adapted_function<&ssl_api::evp_kdf_ctx_new, owned_kdf_ctx(kdf)>
+      new_kdf_ctx{*this};
+
+    simple_adapted_function<&ssl_api::evp_kdf_ctx_free, void(owned_kdf_ctx)>
+      delete_kdf_ctx{*this};
+
+    simple_adapted_function<&ssl_api::evp_kdf_ctx_reset, void(kdf_ctx)>
+      kdf_ctx_reset{*this};
+
+    simple_adapted_function<
+      &ssl_api::evp_kdf_derive,
+      c_api::collapsed<int>(kdf_ctx, memory::block, param_list)>
+      kdf_derive{*this};
+
+    // mac
+    simple_adapted_function<
+      &ssl_api::evp_mac_fetch,
+      owned_mac_algorithm(lib_ctx, string_view, string_view)>
+      fetch_mac{*this};
+
+    simple_adapted_function<&ssl_api::evp_mac_free, void(owned_mac_algorithm)>
+      delete_mac_algorithm{*this};
+
     simple_adapted_function<&ssl_api::x509_store_ctx_new, owned_x509_store_ctx()>
       new_x509_store_ctx{*this};
 
@@ -571,9 +834,13 @@ public:
         c_api::collapsed<int>(x509_store_ctx, x509_store, x509, c_api::defaulted)>>
       init_x509_store_ctx{*this};
 
-    simple_adapted_function<
-      &ssl_api::x509_store_ctx_set0_trusted_stack,
-      c_api::collapsed<int>(x509_store_ctx, const object_stack<x509>&)>
+    c_api::combined<
+      simple_adapted_function<
+        &ssl_api::x509_store_ctx_set0_trusted_stack,
+        c_api::collapsed<int>(x509_store_ctx, const object_stack<x509>&)>,
+      simple_adapted_function<
+        &ssl_api::x509_store_ctx_set0_trusted_stack,
+        c_api::collapsed<int>(x509_store_ctx, const object_stack<owned_x509>&)>>
       set_x509_store_trusted_stack{*this};
 
     simple_adapted_function<
@@ -596,11 +863,66 @@ public:
       void(owned_x509_store_ctx)>
       delete_x509_store_ctx{*this};
 
+    simple_adapted_function<
+      &ssl_api::x509_store_ctx_set_purpose,
+      c_api::collapsed<int>(x509_store_ctx, int)>
+      set_x509_store_ctx_purpose{*this};
+
+    simple_adapted_function<
+      &ssl_api::x509_store_ctx_set_flags,
+      void(x509_store_ctx, unsigned long)>
+      set_x509_store_ctx_flags{*this};
+
+    simple_adapted_function<
+      &ssl_api::x509_store_ctx_set_time,
+      void(x509_store_ctx, unsigned long, std::time_t)>
+      set_x509_store_ctx_time{*this};
+
+    simple_adapted_function<
+      &ssl_api::x509_store_ctx_set_depth,
+      void(x509_store_ctx, int)>
+      set_x509_store_ctx_depth{*this};
+
+    simple_adapted_function<
+      &ssl_api::x509_store_ctx_get_error,
+      int(x509_store_ctx)>
+      get_x509_store_ctx_error{*this};
+
+    simple_adapted_function<
+      &ssl_api::x509_store_ctx_get_error_depth,
+      int(x509_store_ctx)>
+      get_x509_store_ctx_error_depth{*this};
+
+    simple_adapted_function<
+      &ssl_api::x509_store_ctx_set_error,
+      void(x509_store_ctx, int)>
+      set_x509_store_ctx_error{*this};
+
+    simple_adapted_function<
+      &ssl_api::x509_store_ctx_get_current_cert,
+      x509(x509_store_ctx)>
+      get_x509_store_ctx_current_cert{*this};
+
+    simple_adapted_function<
+      &ssl_api::x509_store_ctx_set_verify_cb,
+      void(x509_store_ctx, verify_callback)>
+      set_x509_store_ctx_verify_callback{*this};
+
+    simple_adapted_function<
+      &ssl_api::x509_store_ctx_set_ex_data,
+      c_api::collapsed<int>(x509_store_ctx, int, void*)>
+      set_x509_store_ctx_ex_data{*this};
+
     simple_adapted_function<
       &ssl_api::x509_verify_cert,
       c_api::collapsed<int>(x509_store_ctx)>
       x509_verify_certificate{*this};
 
+    simple_adapted_function<
+      &ssl_api::x509_verify_cert_error_string,
+      string_view(long)>
+      x509_verify_error_string{*this};
+
     simple_adapted_function<&ssl_api::x509_store_new, owned_x509_store()>
       new_x509_store{*this};
 
@@ -613,6 +935,11 @@ public:
     simple_adapted_function<&ssl_api::x509_store_free, void(owned_x509_store)>
       delete_x509_store{*this};
 
+    simple_adapted_function<
+      &ssl_api::x509_store_set_flags,
+      c_api::collapsed<int>(x509_store, unsigned long)>
+      set_x509_store_flags{*this};
+
     simple_adapted_function<
       &ssl_api::x509_store_add_cert,
       c_api::collapsed<int>(x509_store, x509)>
@@ -628,6 +955,22 @@ public:
       c_api::collapsed<int>(x509_store, string_view)>
       load_into_x509_store{*this};
 
+    simple_adapted_function<&ssl_api::x509_lookup_hash_dir, x509_lookup_method()>
+      hash_dir_x509_lookup{*this};
+
+    simple_adapted_function<&ssl_api::x509_lookup_file, x509_lookup_method()>
+      file_x509_lookup{*this};
+
+    simple_adapted_function<
+      &ssl_api::x509_store_add_lookup,
+      x509_lookup(x509_store, x509_lookup_method)>
+      add_x509_store_lookup{*this};
+
+    simple_adapted_function<
+      &ssl_api::x509_lookup_ctrl,
+      c_api::collapsed<int>(x509_lookup, int, const char*, long, c_api::defaulted)>
+      control_x509_lookup{*this};
+
     simple_adapted_function<&ssl_api::x509_crl_new, owned_x509_crl()>
       new_x509_crl{*this};
 
@@ -648,6 +991,56 @@ public:
     simple_adapted_function<&ssl_api::x509_get_subject_name, x509_name(x509)>
       get_x509_subject_name{*this};
 
+    simple_adapted_function<&ssl_api::x509_check_ca, int(x509)>
+      check_x509_ca{*this};
+
+    simple_adapted_function<&ssl_api::x509_check_issued, int(x509, x509)>
+      check_x509_issued{*this};
+
+    simple_adapted_function<
+      &ssl_api::x509_issuer_name_hash,
+      unsigned long(x509)>
+      get_x509_issuer_name_hash{*this};
+
+    simple_adapted_function<
+      &ssl_api::x509_check_host,
+      c_api::collapsed<int>(x509, string_view, unsigned, c_api::defaulted)>
+      check_x509_host{*this};
+
+    simple_adapted_function<
+      &ssl_api::x509_check_ip,
+      c_api::collapsed<int>(x509, memory::const_block, unsigned)>
+      check_x509_ip{*this};
+
+    simple_adapted_function<
+      &ssl_api::x509_check_ip_asc,
+      c_api::collapsed<int>(x509, string_view, unsigned)>
+      check_x509_ip_string{*this};
+
+    simple_adapted_function<&ssl_api::x509_cmp, int(x509, x509)>
+      compare_x509{*this};
+
+    simple_adapted_function<
+      &ssl_api::x509_subject_name_hash,
+      unsigned long(x509)>
+      get_x509_subject_name_hash{*this};
+
+    simple_adapted_function<
+      &ssl_api::x509_digest,
+      c_api::head_transformed<unsigned, 4, 3>(
+        x509,
+        message_digest_type,
+        memory::block)>
+      x509_digest{*this};
+
+    simple_adapted_function<
+      &ssl_api::x509_pubkey_digest,
+      c_api::head_transformed<unsigned, 4, 3>(
+        x509,
+        message_digest_type,
+        memory::block)>
+      x509_pubkey_digest{*this};
+
     simple_adapted_function<&ssl_api::x509_free, void(owned_x509)> delete_x509{
       *this};
 
@@ -671,6 +1064,99 @@ public:
       asn1_string(x509_name_entry)>
       get_name_entry_data{*this};
 
+    simple_adapted_function<&ssl_api::ocsp_request_new, owned_ocsp_request()>
+      new_ocsp_request{*this};
+
+    simple_adapted_function<
+      &ssl_api::ocsp_request_free,
+      void(owned_ocsp_request)>
+      delete_ocsp_request{*this};
+
+    c_api::combined<
+      simple_adapted_function<
+        &ssl_api::ocsp_cert_to_id,
+        owned_ocsp_cert_id(message_digest_type, x509, x509)>,
+      simple_adapted_function<
+        &ssl_api::ocsp_cert_to_id,
+        owned_ocsp_cert_id(c_api::defaulted, x509, x509)>>
+      make_ocsp_cert_id{*this};
+
+    simple_adapted_function<
+      &ssl_api::ocsp_cert_id_dup,
+      owned_ocsp_cert_id(ocsp_cert_id)>
+      copy_ocsp_cert_id{*this};
+
+    simple_adapted_function<
+      &ssl_api::ocsp_cert_id_free,
+      void(owned_ocsp_cert_id)>
+      delete_ocsp_cert_id{*this};
+
+    simple_adapted_function<
+      &ssl_api::ocsp_id_cmp,
+      int(ocsp_cert_id, ocsp_cert_id)>
+      compare_ocsp_cert_id{*this};
+
+    simple_adapted_function<
+      &ssl_api::ocsp_request_add0_id,
+      ocsp_one_request(ocsp_request, owned_ocsp_cert_id)>
+      add_into_ocsp_request{*this};
+
+    simple_adapted_function<
+      &ssl_api::ocsp_request_add1_nonce,
+      c_api::collapsed<int>(ocsp_request, c_api::defaulted, c_api::defaulted)>
+      add_nonce_into_ocsp_request{*this};
+
+    simple_adapted_function<
+      &ssl_api::ocsp_check_nonce,
+      int(ocsp_request, ocsp_basic_response)>
+      check_ocsp_nonce{*this};
+
+    simple_adapted_function<
+      &ssl_api::ocsp_response_free,
+      void(owned_ocsp_response)>
+      delete_ocsp_response{*this};
+
+    simple_adapted_function<&ssl_api::ocsp_response_status, int(ocsp_response)>
+      get_ocsp_response_status{*this};
+
+    simple_adapted_function<
+      &ssl_api::ocsp_response_get1_basic,
+      owned_ocsp_basic_response(ocsp_response)>
+      get_ocsp_basic_response{*this};
+
+    simple_adapted_function<
+      &ssl_api::ocsp_basic_response_free,
+      void(owned_ocsp_basic_response)>
+      delete_ocsp_basic_response{*this};
+
+    c_api::combined<
+      simple_adapted_function<
+        &ssl_api::ocsp_basic_verify,
+        c_api::collapsed<int>(
+          ocsp_basic_response,
+          const object_stack<x509>&,
+          x509_store,
+          unsigned long)>,
+      simple_adapted_function<
+        &ssl_api::ocsp_basic_verify,
+        c_api::collapsed<int>(
+          ocsp_basic_response,
+          const object_stack<x509>&,
+          x509_store,
+          c_api::defaulted)>>
+      ocsp_verify_basic_response{*this};
+
+    simple_adapted_function<
+      &ssl_api::ocsp_response_status_str,
+      string_view(long)>
+      ocsp_response_status_string{*this};
+
+    simple_adapted_function<&ssl_api::ocsp_cert_status_str, string_view(long)>
+      ocsp_cert_status_string{*this};
+
+    simple_adapted_function<&ssl_api::ocsp_crl_reason_str, string_view(long)>
+      ocsp_crl_reason_string{*this};
+
     c_api::combined<
       simple_adapted_function<
         &ssl_api::pem_read_bio_private_key,
@@ -723,10 +1209,107 @@ public:
         owned_x509(basic_io, c_api::defaulted, c_api::defaulted, c_api::defaulted)>>
       read_bio_x509{*this};
 
+    simple_adapted_function<
+      &ssl_api::d2i_x509_bio,
+      owned_x509(basic_io, c_api::defaulted)>
+      read_bio_der_x509{*this};
+
+    c_api::combined<
+      simple_adapted_function<
+        &ssl_api::pem_write_bio_pkcs8_private_key,
+        c_api::collapsed<int>(
+          basic_io,
+          pkey,
+          cipher_type,
+          string_view,
+          c_api::defaulted,
+          c_api::defaulted)>,
+      simple_adapted_function<
+        &ssl_api::pem_write_bio_pkcs8_private_key,
+        c_api::collapsed<int>(
+          basic_io,
+          pkey,
+          cipher_type,
+          c_api::defaulted,
+          c_api::defaulted,
+          password_callback)>>
+      write_bio_pkcs8_private_key{*this};
+
+    c_api::combined<
+      simple_adapted_function<
+        &ssl_api::i2d_pkcs8_private_key_bio,
+        c_api::collapsed<int>(
+          basic_io,
+          pkey,
+          cipher_type,
+          string_view,
+          c_api::defaulted,
+          c_api::defaulted)>,
+      simple_adapted_function<
+        &ssl_api::i2d_pkcs8_private_key_bio,
+        c_api::collapsed<int>(
+          basic_io,
+          pkey,
+          cipher_type,
+          c_api::defaulted,
+          c_api::defaulted,
+          password_callback)>>
+      write_bio_der_pkcs8_private_key{*this};
+
     basic_ssl_operations(api_traits& traits)
       : ssl_api{traits} {}
 };
 //------------------------------------------------------------------------------
+/// @brief Optional algorithm-specific parameters of key generation.
+/// @see basic_ssl_api::generate_key
+export struct key_generation_params {
+    /// @brief The size of the RSA modulus in bits, ignored if zero.
+    int rsa_key_bits{0};
+    /// @brief The name of the elliptic curve group, ignored if empty.
+    string_view group_name{};
+};
+//------------------------------------------------------------------------------
+/// @brief Providers to load and algorithms to pre-fetch during warm-up.
+/// @see basic_ssl_api::warm_up
+export struct warm_up_options {
+    /// @brief The library context to warm up, null means the default one.
+    lib_ctx libctx{};
+    std::vector<std::string> providers{"default"};
+    /// @brief Run the self-test of each loaded provider.
+    bool self_test{true};
+    std::vector<std::string> digests{"SHA256", "SHA384", "SHA512"};
+    std::vector<std::string> ciphers{
+      "AES-128-GCM",
+      "AES-256-GCM",
+      "ChaCha20-Poly1305"};
+    std::vector<std::string> macs{"HMAC"};
+    std::vector<std::string> kdfs{"HKDF"};
+};
+
+/// @brief Outcome and duration of a single warm-up step.
+/// @see warm_up_report
+export struct warm_up_step {
+    string_view kind;
+    std::string name;
+    bool succeeded{false};
+    std::chrono::duration<float> duration{};
+};
+
+/// @brief Result of the provider and algorithm warm-up.
+/// @see basic_ssl_api::warm_up
+export struct warm_up_report {
+    std::vector<warm_up_step> steps;
+    /// @brief Providers loaded by the warm-up, to be unloaded by the caller.
+    std::vector<provider> providers;
+    std::chrono::duration<float> duration{};
+
+    auto all_succeeded() const noexcept -> bool {
+        return std::all_of(steps.begin(), steps.end(), [](const auto& step) {
+            return step.succeeded;
+        });
+    }
+};
+//------------------------------------------------------------------------------
 export template <typename ApiTraits>
 class basic_ssl_api
   : public main_ctx_object
@@ -811,11 +1394,91 @@ public:
         return do_data_digest(data, dst, this->message_digest_sha512());
     }
 
+    /// @brief Writes the digest of the DER encoded certificate into dst.
+    /// @return The head of dst containing the fingerprint or an empty block.
+    template <std::size_t N>
+    auto fingerprint(
+      const x509 cert,
+      const message_digest_type mdtype,
+      std::array<byte, N>& dst) const noexcept -> memory::const_block {
+        // OpenSSL writes the whole digest regardless of the size of dst
+        const auto req_size{
+          mdtype ? this->message_digest_size(mdtype).value_or(0) : 0};
+        if((req_size > 0) and (span_size(N) >= span_size(req_size))) {
+            return this->x509_digest(cert, mdtype, cover(dst)).or_default();
+        }
+        return {};
+    }
+
+    /// @brief Writes the digest of the certificate public key bits into dst.
+    /// @return The head of dst containing the fingerprint or an empty block.
+    /// @note Hashes the content of the key bit string, not the whole SPKI.
+    template <std::size_t N>
+    auto pubkey_fingerprint(
+      const x509 cert,
+      const message_digest_type mdtype,
+      std::array<byte, N>& dst) const noexcept -> memory::const_block {
+        // OpenSSL writes the whole digest regardless of the size of dst
+        const auto req_size{
+          mdtype ? this->message_digest_size(mdtype).value_or(0) : 0};
+        if((req_size > 0) and (span_size(N) >= span_size(req_size))) {
+            return this->x509_pubkey_digest(cert, mdtype, cover(dst)).or_default();
+        }
+        return {};
+    }
+
+    auto is_pure_eddsa_key(const pkey pky) const noexcept -> bool {
+        return this->pkey_is_a(pky, "ED25519").value_or(false) or
+               this->pkey_is_a(pky, "ED448").value_or(false);
+    }
+
+    auto one_shot_sign_data(
+      const memory::const_block data,
+      memory::block dst,
+      const message_digest_type mdtype,
+      const pkey pky) const noexcept -> memory::block {
+        if(pky) {
+            if(ok mdctx{this->new_message_digest()}) {
+                const auto cleanup{this->delete_message_digest.raii(mdctx)};
+
+                if(this->message_digest_sign_init(
+                     mdctx, mdtype, engine{}, pky)) {
+                    size_t size{std_size(dst.size())};
+                    if(this->message_digest_sign(mdctx, dst, size, data)) {
+                        return head(dst, span_size(size));
+                    }
+                }
+            }
+        }
+        return {};
+    }
+
+    auto one_shot_verify_data(
+      const memory::const_block data,
+      const memory::const_block sig,
+      const message_digest_type mdtype,
+      const pkey pky) const noexcept -> bool {
+        if(pky) {
+            if(ok mdctx{this->new_message_digest()}) {
+                const auto cleanup{this->delete_message_digest.raii(mdctx)};
+
+                if(this->message_digest_verify_init(
+                     mdctx, mdtype, engine{}, pky)) {
+                    return bool(this->message_digest_verify(mdctx, sig, data));
+                }
+            }
+        }
+        return false;
+    }
+
     auto sign_data_digest(
       const memory::const_block data,
       memory::block dst,
       const message_digest_type mdtype,
       const pkey pky) const noexcept -> memory::block {
+        if(pky and is_pure_eddsa_key(pky)) {
+            return one_shot_sign_data(data, dst, message_digest_type{}, pky);
+        }
         if(mdtype and pky) {
             if(ok mdctx{this->new_message_digest()}) {
                 const auto cleanup{this->delete_message_digest.raii(mdctx)};
@@ -832,11 +1495,39 @@ public:
         return {};
     }
 
+    auto max_signature_size(const pkey pky) const noexcept -> span_size_t {
+        return this->get_pkey_size(pky).value_or(0);
+    }
+
+    auto sign_data_digest(
+      const memory::const_block data,
+      memory::buffer& dst,
+      const message_digest_type mdtype,
+      const pkey pky) const -> memory::const_block {
+        dst.resize(max_signature_size(pky));
+        const auto sig{sign_data_digest(data, cover(dst), mdtype, pky)};
+        dst.resize(sig.size());
+        return view(dst);
+    }
+
+    /// @brief Signs data into a buffer owned by the calling thread.
+    /// @note The returned signature is valid until the next call on this thread.
+    auto sign_data_digest(
+      const memory::const_block data,
+      const message_digest_type mdtype,
+      const pkey pky) const -> memory::const_block {
+        static thread_local memory::buffer signature_arena;
+        return sign_data_digest(data, signature_arena, mdtype, pky);
+    }
+
     auto verify_data_digest(
       const memory::const_block data,
       const memory::const_block sig,
       const message_digest_type mdtype,
       const pkey pky) const noexcept -> bool {
+        if(pky and is_pure_eddsa_key(pky)) {
+            return one_shot_verify_data(data, sig, message_digest_type{}, pky);
+        }
         if(mdtype and pky) {
             if(ok mdctx{this->new_message_digest()}) {
                 const auto cleanup{this->delete_message_digest.raii(mdctx)};
@@ -853,6 +1544,204 @@ public:
         return false;
     }
 
+    /// @brief Generates a new key for the specified algorithm (RSA, EC, X25519, ...).
+    /// @return The generated key or an empty handle on failure.
+    auto generate_key(
+      const string_view algorithm,
+      const key_generation_params& params = {}) const noexcept -> owned_pkey {
+        if(ok kctx{
+             this->new_pkey_ctx_from_name(lib_ctx{}, algorithm, string_view{})}) {
+            const auto del_kctx{this->delete_pkey_ctx.raii(kctx)};
+
+            if(this->pkey_keygen_init(kctx)) {
+                if(params.rsa_key_bits > 0) {
+                    if(not this->set_pkey_rsa_keygen_bits(
+                         kctx, params.rsa_key_bits)) {
+                        return {};
+                    }
+                }
+                if(not params.group_name.empty()) {
+                    if(not this->set_pkey_group_name(kctx, params.group_name)) {
+                        return {};
+                    }
+                }
+                if(ok key{this->pkey_keygen(kctx)}) {
+                    return std::move(key.get());
+                }
+            }
+        }
+        return {};
+    }
+
+    /// @brief Wipes the copy of the octet string parameter with the specified key.
+    void cleanse_param_octets(const param_list params, const string_view key)
+      const noexcept {
+        if(const auto param{this->locate_param(params, key)}) {
+            const void* ptr{nullptr};
+            size_t size{0};
+            if(this->get_param_octets_ptr(*param, ptr, size)) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+                this->cleanse_memory(
+                  {static_cast<byte*>(const_cast<void*>(ptr)),
+                   span_size(size)});
+            }
+        }
+    }
+
+    /// @brief Derives the secret shared with peer using an initialized context.
+    /// @see derive_shared_secret
+    auto derive_peer_secret(
+      const pkey_ctx dctx,
+      const pkey peer,
+      memory::block dst) const noexcept -> memory::block {
+        if(this->pkey_derive_set_peer(dctx, peer)) {
+            size_t size{std_size(dst.size())};
+            if(this->pkey_derive(dctx, dst, size)) {
+                return head(dst, span_size(size));
+            }
+        }
+        return {};
+    }
+
+    /// @brief Derives the secret shared by the own and peer key (ECDH, X25519).
+    /// @return The head of dst containing the secret or an empty block.
+    auto derive_shared_secret(
+      const pkey own,
+      const pkey peer,
+      memory::block dst) const noexcept -> memory::block {
+        if(own and peer) {
+            if(ok dctx{this->new_pkey_ctx(own, engine{})}) {
+                const auto del_dctx{this->delete_pkey_ctx.raii(dctx)};
+
+                if(this->pkey_derive_init(dctx)) {
+                    return derive_peer_secret(dctx, peer, dst);
+                }
+            }
+        }
+        return {};
+    }
+
+    /// @brief Derives the secrets shared by the own key and each of the peers.
+    /// @return The number of derived secrets.
+    ///
+    /// The secrets are written consecutively into dst and the views of
+    /// the individual secrets are stored into the secrets span. The derive
+    /// context is initialized once and reused for all peers. Stops on the
+    /// first failure.
+    auto derive_shared_secrets(
+      const pkey own,
+      const std::span<const pkey> peers,
+      memory::block dst,
+      const std::span<memory::block> secrets) const noexcept -> span_size_t {
+        span_size_t count{0};
+        if(own) {
+            if(ok dctx{this->new_pkey_ctx(own, engine{})}) {
+                const auto del_dctx{this->delete_pkey_ctx.raii(dctx)};
+
+                if(this->pkey_derive_init(dctx)) {
+                    const auto limit{std::min(peers.size(), secrets.size())};
+                    for(std::size_t i = 0; i < limit; ++i) {
+                        const auto secret{
+                          derive_peer_secret(dctx, peers[i], dst)};
+                        if(not secret) {
+                            break;
+                        }
+                        secrets[i] = secret;
+                        dst = skip(dst, secret.size());
+                        ++count;
+                    }
+                }
+            }
+        }
+        return count;
+    }
+
+    /// @brief Loads providers and pre-fetches algorithms, timing each step.
+    /// @see warm_up_options
+    ///
+    /// Moves the provider activation and the method store population out
+    /// of the first requests using the algorithms. The fetched algorithms
+    /// are released right away, they stay cached in the library context.
+    auto warm_up(const warm_up_options& opts = {}) const -> warm_up_report {
+        using clock = std::chrono::steady_clock;
+        warm_up_report report;
+        const auto start{clock::now()};
+
+        const auto step{[&](
+                          const string_view kind,
+                          const string_view name,
+                          const auto& func) {
+            const auto step_start{clock::now()};
+            const bool succeeded{func(name)};
+            auto& done{report.steps.emplace_back(
+              kind, to_string(name), succeeded, clock::now() - step_start)};
+            this->log_debug("warm-up ${kind} ${name}: ${duration}")
+              .arg(identifier{"kind"}, done.kind)
+              .arg(identifier{"name"}, done.name)
+              .arg(identifier{"succeeded"}, done.succeeded)
+              .arg(identifier{"duration"}, done.duration);
+        }};
+
+        for(const auto& name : opts.providers) {
+            step("provider", name, [&](const string_view prov_name) {
+                if(ok prov{this->load_provider(opts.libctx, prov_name)}) {
+                    report.providers.push_back(prov.get());
+                    return not opts.self_test or
+                           this->provider_self_test(prov).value_or(false);
+                }
+                return false;
+            });
+        }
+        for(const auto& name : opts.digests) {
+            step("digest", name, [&](const string_view alg) {
+                if(ok fetched{this->fetch_message_digest(
+                     opts.libctx, alg, string_view{})}) {
+                    this->delete_message_digest_algorithm(
+                      std::move(fetched.get()));
+                    return true;
+                }
+                return false;
+            });
+        }
+        for(const auto& name : opts.ciphers) {
+            step("cipher", name, [&](const string_view alg) {
+                if(ok fetched{
+                     this->fetch_cipher(opts.libctx, alg, string_view{})}) {
+                    this->delete_cipher_algorithm(std::move(fetched.get()));
+                    return true;
+                }
+                return false;
+            });
+        }
+        for(const auto& name : opts.macs) {
+            step("mac", name, [&](const string_view alg) {
+                if(ok fetched{
+                     this->fetch_mac(opts.libctx, alg, string_view{})}) {
+                    this->delete_mac_algorithm(std::move(fetched.get()));
+                    return true;
+                }
+                return false;
+            });
+        }
+        for(const auto& name : opts.kdfs) {
+            step("kdf", name, [&](const string_view alg) {
+                if(ok fetched{
+                     this->fetch_kdf(opts.libctx, alg, string_view{})}) {
+                    this->delete_kdf(std::move(fetched.get()));
+                    return true;
+                }
+                return false;
+            });
+        }
+
+        report.duration = clock::now() - start;
+        this->log_info("warm-up finished in ${duration}")
+          .arg(identifier{"steps"}, span_size(report.steps.size()))
+          .arg(identifier{"succeeded"}, report.all_succeeded())
+          .arg(identifier{"duration"}, report.duration);
+        return report;
+    }
+
     auto parse_private_key(
       const memory::const_block blk,
       password_callback get_passwd = {}) const noexcept
@@ -892,6 +1781,17 @@ public:
         return {};
     }
 
+    auto parse_der_x509(const memory::const_block blk) const noexcept
+      -> combined_result<owned_x509> {
+        if(ok mbio{this->new_block_basic_io(blk)}) {
+            const auto del_bio{this->delete_basic_io.raii(mbio)};
+
+            return this->read_bio_der_x509(mbio);
+        }
+
+        return {};
+    }
+
     auto ca_verify_certificate(const string_view ca_file_path, const x509 cert)
       const noexcept -> bool {
         if(ok store{this->new_x509_store()}) {
@@ -914,6 +1814,45 @@ public:
         return false;
     }
 
+    /// @brief Attaches a lookup of CA certificates in a hashed directory.
+    /// @see basic_issuer_cache
+    ///
+    /// The directory is expected to contain PEM files named by the hash
+    /// of the subject name, as created by `openssl rehash`. The issuers are
+    /// loaded on demand during verification instead of up-front.
+    auto add_x509_store_hash_dir(const x509_store store, const string_view dir)
+      const noexcept -> bool {
+        if(ok method{this->hash_dir_x509_lookup()}) {
+            if(ok lookup{this->add_x509_store_lookup(store, method)}) {
+                const std::string path{dir.data(), std_size(dir.size())};
+                return bool(this->control_x509_lookup(
+                  lookup,
+                  this->x509_l_add_dir,
+                  path.c_str(),
+                  this->x509_filetype_pem));
+            }
+        }
+        return false;
+    }
+
+    /// @brief Installs the verification callback into the store context.
+    /// @note The callback object must outlive the verification.
+    /// @return False if the callback is empty or could not be installed.
+    auto set_verify_callback(
+      const x509_store_ctx vrfy_ctx,
+      verify_callback& callback) const noexcept -> bool {
+        // OpenSSL does not accept a null verify_cb
+        if(not callback.native_func()) {
+            return false;
+        }
+        if(this->set_x509_store_ctx_ex_data(
+             vrfy_ctx, verify_callback::ex_data_index(), callback.native_data())) {
+            this->set_x509_store_ctx_verify_callback(vrfy_ctx, callback);
+            return true;
+        }
+        return false;
+    }
+
     auto ca_verify_certificate(const x509 ca_cert, const x509 cert)
       const noexcept -> bool {
         if(ok store{this->new_x509_store()}) {
@@ -0,0 +1,46 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+module;
+
+#if __has_include(<openssl/x509_vfy.h>)
+#include <openssl/x509_vfy.h>
+
+#define EAGINE_HAS_SSL 1
+#else
+#define EAGINE_HAS_SSL 0
+#endif
+
+module eagine.sslplus;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+// verify_callback
+//------------------------------------------------------------------------------
+auto verify_callback::ex_data_index() noexcept -> int {
+#if EAGINE_HAS_SSL
+    static const int index{
+      X509_STORE_CTX_get_ex_new_index(0L, nullptr, nullptr, nullptr, nullptr)};
+    return index;
+#else
+    return -1;
+#endif
+}
+//------------------------------------------------------------------------------
+auto verify_callback::_impl(
+  const int preverified,
+  [[maybe_unused]] ssl_types::x509_store_ctx_type* ctx) noexcept -> int {
+#if EAGINE_HAS_SSL
+    if(auto* self{static_cast<verify_callback*>(
+         X509_STORE_CTX_get_ex_data(ctx, ex_data_index()))}) {
+        return self->_callback(preverified != 0, x509_store_ctx{ctx}) ? 1 : 0;
+    }
+#endif
+    return preverified;
+}
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
@@ -13,11 +13,20 @@ module;
 #include <openssl/crypto.h>
 #include <openssl/err.h>
 #include <openssl/evp.h>
+#include <openssl/kdf.h>
+#include <openssl/ocsp.h>
+#include <openssl/param_build.h>
+#include <openssl/params.h>
 #include <openssl/pem.h>
 #include <openssl/provider.h>
 #include <openssl/rand.h>
+#include <openssl/rsa.h>
 #include <openssl/safestack.h>
+#if __has_include(<openssl/thread.h>)
+#include <openssl/thread.h>
+#endif
 #include <openssl/ui.h>
+#include <openssl/x509v3.h>
 #define EAGINE_HAS_SSL 1
 #else
 #define EAGINE_HAS_SSL 0
@@ -39,6 +48,11 @@ auto ssl_api_traits ::_link_function(const string_view name) -> _any_fnptr_t {
     EAGINE_GET_OPENSSL_FUNC(ERR_get_error)
     EAGINE_GET_OPENSSL_FUNC(ERR_peek_error)
     EAGINE_GET_OPENSSL_FUNC(ERR_error_string_n)
+    EAGINE_GET_OPENSSL_FUNC(OPENSSL_cleanse)
+    EAGINE_GET_OPENSSL_FUNC(CRYPTO_secure_malloc_init)
+    EAGINE_GET_OPENSSL_FUNC(CRYPTO_secure_malloc_initialized)
+    EAGINE_GET_OPENSSL_FUNC(CRYPTO_secure_malloc_done)
+    EAGINE_GET_OPENSSL_FUNC(CRYPTO_secure_used)
     EAGINE_GET_OPENSSL_FUNC(UI_null)
     EAGINE_GET_OPENSSL_FUNC(UI_OpenSSL)
     EAGINE_GET_OPENSSL_FUNC(UI_get_default_method)
@@ -49,6 +63,19 @@ auto ssl_api_traits ::_link_function(const string_view name) -> _any_fnptr_t {
     EAGINE_GET_OPENSSL_FUNC(OSSL_LIB_CTX_get0_global_default)
     EAGINE_GET_OPENSSL_FUNC(OSSL_LIB_CTX_set0_default)
     EAGINE_GET_OPENSSL_FUNC(OSSL_LIB_CTX_free)
+    EAGINE_GET_OPENSSL_FUNC(OSSL_PARAM_BLD_new)
+    EAGINE_GET_OPENSSL_FUNC(OSSL_PARAM_BLD_free)
+    EAGINE_GET_OPENSSL_FUNC(OSSL_PARAM_BLD_push_utf8_string)
+    EAGINE_GET_OPENSSL_FUNC(OSSL_PARAM_BLD_push_octet_string)
+    EAGINE_GET_OPENSSL_FUNC(OSSL_PARAM_BLD_push_uint32)
+    EAGINE_GET_OPENSSL_FUNC(OSSL_PARAM_BLD_push_uint64)
+    EAGINE_GET_OPENSSL_FUNC(OSSL_PARAM_BLD_to_param)
+    EAGINE_GET_OPENSSL_FUNC(OSSL_PARAM_free)
+    EAGINE_GET_OPENSSL_FUNC(OSSL_PARAM_locate)
+    EAGINE_GET_OPENSSL_FUNC(OSSL_PARAM_get_octet_string_ptr)
+#if OPENSSL_VERSION_NUMBER >= 0x30200000L
+    EAGINE_GET_OPENSSL_FUNC(OSSL_set_max_threads)
+#endif
     EAGINE_GET_OPENSSL_FUNC(OSSL_PROVIDER_set_default_search_path)
     EAGINE_GET_OPENSSL_FUNC(OSSL_PROVIDER_load)
     EAGINE_GET_OPENSSL_FUNC(OSSL_PROVIDER_try_load)
@@ -68,15 +95,32 @@ auto ssl_api_traits ::_link_function(const string_view name) -> _any_fnptr_t {
     EAGINE_GET_OPENSSL_FUNC(BIO_free)
     EAGINE_GET_OPENSSL_FUNC(BIO_free_all)
     EAGINE_GET_OPENSSL_FUNC(RAND_bytes)
+    EAGINE_GET_OPENSSL_FUNC(RAND_priv_bytes)
+    EAGINE_GET_OPENSSL_FUNC(RAND_bytes_ex)
+    EAGINE_GET_OPENSSL_FUNC(RAND_priv_bytes_ex)
     EAGINE_GET_OPENSSL_FUNC(EVP_PKEY_new)
     EAGINE_GET_OPENSSL_FUNC(EVP_PKEY_up_ref)
     EAGINE_GET_OPENSSL_FUNC(EVP_PKEY_free)
+    EAGINE_GET_OPENSSL_FUNC(EVP_PKEY_is_a)
+    EAGINE_GET_OPENSSL_FUNC(EVP_PKEY_get_size)
+    EAGINE_GET_OPENSSL_FUNC(EVP_PKEY_CTX_new)
+    EAGINE_GET_OPENSSL_FUNC(EVP_PKEY_CTX_new_from_name)
+    EAGINE_GET_OPENSSL_FUNC(EVP_PKEY_CTX_free)
+    EAGINE_GET_OPENSSL_FUNC(EVP_PKEY_keygen_init)
+    EAGINE_GET_OPENSSL_FUNC(EVP_PKEY_keygen)
+    EAGINE_GET_OPENSSL_FUNC(EVP_PKEY_CTX_set_rsa_keygen_bits)
+    EAGINE_GET_OPENSSL_FUNC(EVP_PKEY_CTX_set_group_name)
+    EAGINE_GET_OPENSSL_FUNC(EVP_PKEY_derive_init)
+    EAGINE_GET_OPENSSL_FUNC(EVP_PKEY_derive_set_peer)
+    EAGINE_GET_OPENSSL_FUNC(EVP_PKEY_derive)
     EAGINE_GET_OPENSSL_FUNC(EVP_aes_128_ctr)
     EAGINE_GET_OPENSSL_FUNC(EVP_aes_128_ccm)
     EAGINE_GET_OPENSSL_FUNC(EVP_aes_128_gcm)
     EAGINE_GET_OPENSSL_FUNC(EVP_aes_128_xts)
     EAGINE_GET_OPENSSL_FUNC(EVP_aes_192_ecb)
     EAGINE_GET_OPENSSL_FUNC(EVP_aes_192_cbc)
+    EAGINE_GET_OPENSSL_FUNC(EVP_CIPHER_fetch)
+    EAGINE_GET_OPENSSL_FUNC(EVP_CIPHER_free)
     EAGINE_GET_OPENSSL_FUNC(EVP_CIPHER_CTX_new)
     EAGINE_GET_OPENSSL_FUNC(EVP_CIPHER_CTX_reset)
     EAGINE_GET_OPENSSL_FUNC(EVP_CIPHER_CTX_free)
@@ -103,11 +147,14 @@ auto ssl_api_traits ::_link_function(const string_view name) -> _any_fnptr_t {
     EAGINE_GET_OPENSSL_FUNC(EVP_sha384)
     EAGINE_GET_OPENSSL_FUNC(EVP_sha512)
     EAGINE_GET_OPENSSL_FUNC(EVP_get_digestbyname)
+    EAGINE_GET_OPENSSL_FUNC(EVP_MD_fetch)
+    EAGINE_GET_OPENSSL_FUNC(EVP_MD_free)
     EAGINE_GET_OPENSSL_FUNC(EVP_MD_size)
     EAGINE_GET_OPENSSL_FUNC(EVP_MD_block_size)
     EAGINE_GET_OPENSSL_FUNC(EVP_MD_CTX_new)
     EAGINE_GET_OPENSSL_FUNC(EVP_MD_CTX_reset)
     EAGINE_GET_OPENSSL_FUNC(EVP_MD_CTX_free)
+    EAGINE_GET_OPENSSL_FUNC(EVP_MD_CTX_copy_ex)
     EAGINE_GET_OPENSSL_FUNC(EVP_DigestInit)
     EAGINE_GET_OPENSSL_FUNC(EVP_DigestInit_ex)
     EAGINE_GET_OPENSSL_FUNC(EVP_DigestUpdate)
@@ -116,11 +163,23 @@ auto ssl_api_traits ::_link_function(const string_view name) -> _any_fnptr_t {
     EAGINE_GET_OPENSSL_FUNC(EVP_DigestSignInit)
     EAGINE_GET_OPENSSL_FUNC(EVP_DigestUpdate)
     EAGINE_GET_OPENSSL_FUNC(EVP_DigestSignFinal)
+    EAGINE_GET_OPENSSL_FUNC(EVP_DigestSign)
     EAGINE_GET_OPENSSL_FUNC(EVP_DigestVerifyInit)
     EAGINE_GET_OPENSSL_FUNC(EVP_DigestUpdate)
     EAGINE_GET_OPENSSL_FUNC(EVP_DigestVerifyFinal)
+    EAGINE_GET_OPENSSL_FUNC(EVP_DigestVerify)
+    EAGINE_GET_OPENSSL_FUNC(EVP_KDF_fetch)
+    EAGINE_GET_OPENSSL_FUNC(EVP_KDF_free)
+    EAGINE_GET_OPENSSL_FUNC(EVP_KDF_CTX_new)
+    EAGINE_GET_OPENSSL_FUNC(EVP_KDF_CTX_free)
+    EAGINE_GET_OPENSSL_FUNC(EVP_KDF_CTX_reset)
+    EAGINE_GET_OPENSSL_FUNC(EVP_KDF_derive)
+    EAGINE_GET_OPENSSL_FUNC(EVP_MAC_fetch)
+    EAGINE_GET_OPENSSL_FUNC(EVP_MAC_free)
     EAGINE_GET_OPENSSL_FUNC(X509_LOOKUP_hash_dir)
     EAGINE_GET_OPENSSL_FUNC(X509_LOOKUP_file)
+    EAGINE_GET_OPENSSL_FUNC(X509_STORE_add_lookup)
+    EAGINE_GET_OPENSSL_FUNC(X509_LOOKUP_ctrl)
     EAGINE_GET_OPENSSL_FUNC(X509_STORE_CTX_new)
     EAGINE_GET_OPENSSL_FUNC(X509_STORE_CTX_init)
     EAGINE_GET_OPENSSL_FUNC(X509_STORE_CTX_set0_trusted_stack)
@@ -128,12 +187,24 @@ auto ssl_api_traits ::_link_function(const string_view name) -> _any_fnptr_t {
     EAGINE_GET_OPENSSL_FUNC(X509_STORE_CTX_set0_untrusted)
     EAGINE_GET_OPENSSL_FUNC(X509_STORE_CTX_cleanup)
     EAGINE_GET_OPENSSL_FUNC(X509_STORE_CTX_free)
+    EAGINE_GET_OPENSSL_FUNC(X509_STORE_CTX_set_purpose)
+    EAGINE_GET_OPENSSL_FUNC(X509_STORE_CTX_set_flags)
+    EAGINE_GET_OPENSSL_FUNC(X509_STORE_CTX_set_time)
+    EAGINE_GET_OPENSSL_FUNC(X509_STORE_CTX_set_depth)
+    EAGINE_GET_OPENSSL_FUNC(X509_STORE_CTX_get_error)
+    EAGINE_GET_OPENSSL_FUNC(X509_STORE_CTX_get_error_depth)
+    EAGINE_GET_OPENSSL_FUNC(X509_STORE_CTX_set_error)
+    EAGINE_GET_OPENSSL_FUNC(X509_STORE_CTX_get_current_cert)
+    EAGINE_GET_OPENSSL_FUNC(X509_STORE_CTX_set_verify_cb)
+    EAGINE_GET_OPENSSL_FUNC(X509_STORE_CTX_set_ex_data)
     EAGINE_GET_OPENSSL_FUNC(X509_verify_cert)
+    EAGINE_GET_OPENSSL_FUNC(X509_verify_cert_error_string)
     EAGINE_GET_OPENSSL_FUNC(X509_STORE_new)
     EAGINE_GET_OPENSSL_FUNC(X509_STORE_up_ref)
     EAGINE_GET_OPENSSL_FUNC(X509_STORE_lock)
     EAGINE_GET_OPENSSL_FUNC(X509_STORE_unlock)
     EAGINE_GET_OPENSSL_FUNC(X509_STORE_free)
+    EAGINE_GET_OPENSSL_FUNC(X509_STORE_set_flags)
     EAGINE_GET_OPENSSL_FUNC(X509_STORE_add_cert)
     EAGINE_GET_OPENSSL_FUNC(X509_STORE_add_crl)
     EAGINE_GET_OPENSSL_FUNC(X509_STORE_load_locations)
@@ -146,15 +217,45 @@ auto ssl_api_traits ::_link_function(const string_view name) -> _any_fnptr_t {
     EAGINE_GET_OPENSSL_FUNC(X509_get_issuer_name)
     EAGINE_GET_OPENSSL_FUNC(X509_get_subject_name)
     EAGINE_GET_OPENSSL_FUNC(X509_get_ext_count)
+    EAGINE_GET_OPENSSL_FUNC(X509_check_ca)
+    EAGINE_GET_OPENSSL_FUNC(X509_issuer_name_hash)
+    EAGINE_GET_OPENSSL_FUNC(X509_check_issued)
+    EAGINE_GET_OPENSSL_FUNC(X509_check_host)
+    EAGINE_GET_OPENSSL_FUNC(X509_check_ip)
+    EAGINE_GET_OPENSSL_FUNC(X509_check_ip_asc)
+    EAGINE_GET_OPENSSL_FUNC(X509_cmp)
+    EAGINE_GET_OPENSSL_FUNC(X509_subject_name_hash)
+    EAGINE_GET_OPENSSL_FUNC(X509_digest)
+    EAGINE_GET_OPENSSL_FUNC(X509_pubkey_digest)
     EAGINE_GET_OPENSSL_FUNC(X509_free)
     EAGINE_GET_OPENSSL_FUNC(X509_NAME_entry_count)
     EAGINE_GET_OPENSSL_FUNC(X509_NAME_get_entry)
     EAGINE_GET_OPENSSL_FUNC(X509_NAME_ENTRY_get_object)
     EAGINE_GET_OPENSSL_FUNC(X509_NAME_ENTRY_get_data)
+    EAGINE_GET_OPENSSL_FUNC(OCSP_REQUEST_new)
+    EAGINE_GET_OPENSSL_FUNC(OCSP_REQUEST_free)
+    EAGINE_GET_OPENSSL_FUNC(OCSP_cert_to_id)
+    EAGINE_GET_OPENSSL_FUNC(OCSP_CERTID_dup)
+    EAGINE_GET_OPENSSL_FUNC(OCSP_CERTID_free)
+    EAGINE_GET_OPENSSL_FUNC(OCSP_id_cmp)
+    EAGINE_GET_OPENSSL_FUNC(OCSP_request_add0_id)
+    EAGINE_GET_OPENSSL_FUNC(OCSP_request_add1_nonce)
+    EAGINE_GET_OPENSSL_FUNC(OCSP_check_nonce)
+    EAGINE_GET_OPENSSL_FUNC(OCSP_RESPONSE_free)
+    EAGINE_GET_OPENSSL_FUNC(OCSP_response_status)
+    EAGINE_GET_OPENSSL_FUNC(OCSP_response_get1_basic)
+    EAGINE_GET_OPENSSL_FUNC(OCSP_BASICRESP_free)
+    EAGINE_GET_OPENSSL_FUNC(OCSP_basic_verify)
+    EAGINE_GET_OPENSSL_FUNC(OCSP_response_status_str)
+    EAGINE_GET_OPENSSL_FUNC(OCSP_cert_status_str)
+    EAGINE_GET_OPENSSL_FUNC(OCSP_crl_reason_str)
     EAGINE_GET_OPENSSL_FUNC(PEM_read_bio_PrivateKey)
     EAGINE_GET_OPENSSL_FUNC(PEM_read_bio_PUBKEY)
     EAGINE_GET_OPENSSL_FUNC(PEM_read_bio_X509_CRL)
     EAGINE_GET_OPENSSL_FUNC(PEM_read_bio_X509)
+    EAGINE_GET_OPENSSL_FUNC(PEM_write_bio_PKCS8PrivateKey)
+    EAGINE_GET_OPENSSL_FUNC(d2i_X509_bio)
+    EAGINE_GET_OPENSSL_FUNC(i2d_PKCS8PrivateKey_bio)
 #undef EAGINE_GET_OPENSSL_FUNC
 #endif
     return nullptr;
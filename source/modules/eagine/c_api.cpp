@@ -36,6 +36,8 @@ public:
     using dispatch_type = ssl_types::dispatch_type;
     using core_handle_type = ssl_types::core_handle_type;
     using lib_ctx_type = ssl_types::lib_ctx_type;
+    using param_type = ssl_types::param_type;
+    using param_bld_type = ssl_types::param_bld_type;
     using provider_type = ssl_types::provider_type;
     using engine_type = ssl_types::engine_type;
     using asn1_object_type = ssl_types::asn1_object_type;
@@ -47,8 +49,16 @@ public:
     using evp_pkey_type = ssl_types::evp_pkey_type;
     using evp_cipher_ctx_type = ssl_types::evp_cipher_ctx_type;
     using evp_cipher_type = ssl_types::evp_cipher_type;
+    using evp_kdf_ctx_type = ssl_types::evp_kdf_ctx_type;
+    using evp_kdf_type = ssl_types::evp_kdf_type;
+    using evp_mac_type = ssl_types::evp_mac_type;
     using evp_md_ctx_type = ssl_types::evp_md_ctx_type;
     using evp_md_type = ssl_types::evp_md_type;
+    using ocsp_basic_response_type = ssl_types::ocsp_basic_response_type;
+    using ocsp_cert_id_type = ssl_types::ocsp_cert_id_type;
+    using ocsp_one_request_type = ssl_types::ocsp_one_request_type;
+    using ocsp_request_type = ssl_types::ocsp_request_type;
+    using ocsp_response_type = ssl_types::ocsp_response_type;
     using x509_lookup_method_type = ssl_types::x509_lookup_method_type;
     using x509_lookup_type = ssl_types::x509_lookup_type;
     using x509_name_type = ssl_types::x509_name_type;
@@ -95,6 +105,28 @@ public:
       EAGINE_SSL_STATIC_FUNC(ERR_error_string_n)>
       err_error_string_n{"ERR_error_string_n", *this};
 
+    // crypto
+    ssl_api_function<void(void*, size_t), EAGINE_SSL_STATIC_FUNC(OPENSSL_cleanse)>
+      openssl_cleanse{"OPENSSL_cleanse", *this};
+
+    ssl_api_function<
+      int(size_t, size_t),
+      EAGINE_SSL_STATIC_FUNC(CRYPTO_secure_malloc_init)>
+      crypto_secure_malloc_init{"CRYPTO_secure_malloc_init", *this};
+
+    ssl_api_function<
+      int(),
+      EAGINE_SSL_STATIC_FUNC(CRYPTO_secure_malloc_initialized)>
+      crypto_secure_malloc_initialized{
+        "CRYPTO_secure_malloc_initialized",
+        *this};
+
+    ssl_api_function<int(), EAGINE_SSL_STATIC_FUNC(CRYPTO_secure_malloc_done)>
+      crypto_secure_malloc_done{"CRYPTO_secure_malloc_done", *this};
+
+    ssl_api_function<size_t(), EAGINE_SSL_STATIC_FUNC(CRYPTO_secure_used)>
+      crypto_secure_used{"CRYPTO_secure_used", *this};
+
     // ui method
     ssl_api_function<const ui_method_type*(), EAGINE_SSL_STATIC_FUNC(UI_null)>
       ui_null{"UI_null", *this};
@@ -139,6 +171,59 @@ public:
     ssl_api_function<void(lib_ctx_type*), EAGINE_SSL_STATIC_FUNC(OSSL_LIB_CTX_free)>
       lib_ctx_free{"OSSL_LIB_CTX_free", *this};
 
+    // params
+    ssl_api_function<param_bld_type*(), EAGINE_SSL_STATIC_FUNC(OSSL_PARAM_BLD_new)>
+      param_bld_new{"OSSL_PARAM_BLD_new", *this};
+
+    ssl_api_function<
+      void(param_bld_type*),
+      EAGINE_SSL_STATIC_FUNC(OSSL_PARAM_BLD_free)>
+      param_bld_free{"OSSL_PARAM_BLD_free", *this};
+
+    ssl_api_function<
+      int(param_bld_type*, const char*, const char*, size_t),
+      EAGINE_SSL_STATIC_FUNC(OSSL_PARAM_BLD_push_utf8_string)>
+      param_bld_push_utf8_string{"OSSL_PARAM_BLD_push_utf8_string", *this};
+
+    ssl_api_function<
+      int(param_bld_type*, const char*, const void*, size_t),
+      EAGINE_SSL_STATIC_FUNC(OSSL_PARAM_BLD_push_octet_string)>
+      param_bld_push_octet_string{"OSSL_PARAM_BLD_push_octet_string", *this};
+
+    ssl_api_function<
+      int(param_bld_type*, const char*, std::uint32_t),
+      EAGINE_SSL_STATIC_FUNC(OSSL_PARAM_BLD_push_uint32)>
+      param_bld_push_uint32{"OSSL_PARAM_BLD_push_uint32", *this};
+
+    ssl_api_function<
+      int(param_bld_type*, const char*, std::uint64_t),
+      EAGINE_SSL_STATIC_FUNC(OSSL_PARAM_BLD_push_uint64)>
+      param_bld_push_uint64{"OSSL_PARAM_BLD_push_uint64", *this};
+
+    ssl_api_function<
+      param_type*(param_bld_type*),
+      EAGINE_SSL_STATIC_FUNC(OSSL_PARAM_BLD_to_param)>
+      param_bld_to_param{"OSSL_PARAM_BLD_to_param", *this};
+
+    ssl_api_function<void(param_type*), EAGINE_SSL_STATIC_FUNC(OSSL_PARAM_free)>
+      param_free{"OSSL_PARAM_free", *this};
+
+    ssl_api_function<
+      param_type*(param_type*, const char*),
+      EAGINE_SSL_STATIC_FUNC(OSSL_PARAM_locate)>
+      param_locate{"OSSL_PARAM_locate", *this};
+
+    ssl_api_function<
+      int(const param_type*, const void**, size_t*),
+      EAGINE_SSL_STATIC_FUNC(OSSL_PARAM_get_octet_string_ptr)>
+      param_get_octet_string_ptr{"OSSL_PARAM_get_octet_string_ptr", *this};
+
+    // threads
+    ssl_api_function<
+      int(lib_ctx_type*, std::uint64_t),
+      EAGINE_SSL_STATIC_FUNC(OSSL_set_max_threads)>
+      ossl_set_max_threads{"OSSL_set_max_threads", *this};
+
     // provider
     ssl_api_function<
       int(lib_ctx_type*, const char*),
@@ -235,6 +320,21 @@ public:
     ssl_api_function<int(unsigned char*, int num), EAGINE_SSL_STATIC_FUNC(RAND_bytes)>
       rand_bytes{"RAND_bytes", *this};
 
+    ssl_api_function<
+      int(unsigned char*, int num),
+      EAGINE_SSL_STATIC_FUNC(RAND_priv_bytes)>
+      rand_priv_bytes{"RAND_priv_bytes", *this};
+
+    ssl_api_function<
+      int(lib_ctx_type*, unsigned char*, size_t, unsigned),
+      EAGINE_SSL_STATIC_FUNC(RAND_bytes_ex)>
+      rand_bytes_ex{"RAND_bytes_ex", *this};
+
+    ssl_api_function<
+      int(lib_ctx_type*, unsigned char*, size_t, unsigned),
+      EAGINE_SSL_STATIC_FUNC(RAND_priv_bytes_ex)>
+      rand_priv_bytes_ex{"RAND_priv_bytes_ex", *this};
+
     // pkey
     ssl_api_function<evp_pkey_type*(), EAGINE_SSL_STATIC_FUNC(EVP_PKEY_new)>
       evp_pkey_new{"EVP_PKEY_new", *this};
@@ -245,6 +345,69 @@ public:
     ssl_api_function<void(evp_pkey_type*), EAGINE_SSL_STATIC_FUNC(EVP_PKEY_free)>
       evp_pkey_free{"EVP_PKEY_free", *this};
 
+    ssl_api_function<
+      int(const evp_pkey_type*, const char*),
+      EAGINE_SSL_STATIC_FUNC(EVP_PKEY_is_a)>
+      evp_pkey_is_a{"EVP_PKEY_is_a", *this};
+
+    ssl_api_function<
+      int(const evp_pkey_type*),
+      EAGINE_SSL_STATIC_FUNC(EVP_PKEY_get_size)>
+      evp_pkey_get_size{"EVP_PKEY_get_size", *this};
+
+    // pkey context
+    ssl_api_function<
+      evp_pkey_ctx_type*(evp_pkey_type*, engine_type*),
+      EAGINE_SSL_STATIC_FUNC(EVP_PKEY_CTX_new)>
+      evp_pkey_ctx_new{"EVP_PKEY_CTX_new", *this};
+
+    ssl_api_function<
+      evp_pkey_ctx_type*(lib_ctx_type*, const char*, const char*),
+      EAGINE_SSL_STATIC_FUNC(EVP_PKEY_CTX_new_from_name)>
+      evp_pkey_ctx_new_from_name{"EVP_PKEY_CTX_new_from_name", *this};
+
+    ssl_api_function<
+      void(evp_pkey_ctx_type*),
+      EAGINE_SSL_STATIC_FUNC(EVP_PKEY_CTX_free)>
+      evp_pkey_ctx_free{"EVP_PKEY_CTX_free", *this};
+
+    ssl_api_function<
+      int(evp_pkey_ctx_type*),
+      EAGINE_SSL_STATIC_FUNC(EVP_PKEY_keygen_init)>
+      evp_pkey_keygen_init{"EVP_PKEY_keygen_init", *this};
+
+    ssl_api_function<
+      int(evp_pkey_ctx_type*, evp_pkey_type**),
+      EAGINE_SSL_STATIC_FUNC(EVP_PKEY_keygen)>
+      evp_pkey_keygen{"EVP_PKEY_keygen", *this};
+
+    ssl_api_function<
+      int(evp_pkey_ctx_type*, int),
+      EAGINE_SSL_STATIC_FUNC(EVP_PKEY_CTX_set_rsa_keygen_bits)>
+      evp_pkey_ctx_set_rsa_keygen_bits{
+        "EVP_PKEY_CTX_set_rsa_keygen_bits",
+        *this};
+
+    ssl_api_function<
+      int(evp_pkey_ctx_type*, const char*),
+      EAGINE_SSL_STATIC_FUNC(EVP_PKEY_CTX_set_group_name)>
+      evp_pkey_ctx_set_group_name{"EVP_PKEY_CTX_set_group_name", *this};
+
+    ssl_api_function<
+      int(evp_pkey_ctx_type*),
+      EAGINE_SSL_STATIC_FUNC(EVP_PKEY_derive_init)>
+      evp_pkey_derive_init{"EVP_PKEY_derive_init", *this};
+
+    ssl_api_function<
+      int(evp_pkey_ctx_type*, evp_pkey_type*),
+      EAGINE_SSL_STATIC_FUNC(EVP_PKEY_derive_set_peer)>
+      evp_pkey_derive_set_peer{"EVP_PKEY_derive_set_peer", *this};
+
+    ssl_api_function<
+      int(evp_pkey_ctx_type*, unsigned char*, size_t*),
+      EAGINE_SSL_STATIC_FUNC(EVP_PKEY_derive)>
+      evp_pkey_derive{"EVP_PKEY_derive", *this};
+
     ssl_api_function<
       const evp_cipher_type*(),
       EAGINE_SSL_STATIC_FUNC(EVP_aes_128_ctr)>
@@ -275,6 +438,16 @@ public:
       EAGINE_SSL_STATIC_FUNC(EVP_aes_192_cbc)>
       evp_aes_192_cbc{"evp_aes_192_cbc", *this};
 
+    ssl_api_function<
+      evp_cipher_type*(lib_ctx_type*, const char*, const char*),
+      EAGINE_SSL_STATIC_FUNC(EVP_CIPHER_fetch)>
+      evp_cipher_fetch{"EVP_CIPHER_fetch", *this};
+
+    ssl_api_function<
+      void(evp_cipher_type*),
+      EAGINE_SSL_STATIC_FUNC(EVP_CIPHER_free)>
+      evp_cipher_free{"EVP_CIPHER_free", *this};
+
     ssl_api_function<
       evp_cipher_ctx_type*(),
       EAGINE_SSL_STATIC_FUNC(EVP_CIPHER_CTX_new)>
@@ -421,6 +594,14 @@ public:
       EAGINE_SSL_STATIC_FUNC(EVP_get_digestbyname)>
       evp_get_digest_by_name{"EVP_get_digestbyname", *this};
 
+    ssl_api_function<
+      evp_md_type*(lib_ctx_type*, const char*, const char*),
+      EAGINE_SSL_STATIC_FUNC(EVP_MD_fetch)>
+      evp_md_fetch{"EVP_MD_fetch", *this};
+
+    ssl_api_function<void(evp_md_type*), EAGINE_SSL_STATIC_FUNC(EVP_MD_free)>
+      evp_md_free{"EVP_MD_free", *this};
+
     ssl_api_function<int(const evp_md_type*), EAGINE_SSL_STATIC_FUNC(EVP_MD_size)>
       evp_md_size{"EVP_MD_size", *this};
 
@@ -438,6 +619,11 @@ public:
     ssl_api_function<void(evp_md_ctx_type*), EAGINE_SSL_STATIC_FUNC(EVP_MD_CTX_free)>
       evp_md_ctx_free{"EVP_MD_CTX_free", *this};
 
+    ssl_api_function<
+      int(evp_md_ctx_type*, const evp_md_ctx_type*),
+      EAGINE_SSL_STATIC_FUNC(EVP_MD_CTX_copy_ex)>
+      evp_md_ctx_copy_ex{"EVP_MD_CTX_copy_ex", *this};
+
     ssl_api_function<
       int(evp_md_ctx_type*, const evp_md_type*),
       EAGINE_SSL_STATIC_FUNC(EVP_DigestInit)>
@@ -483,6 +669,16 @@ public:
       EAGINE_SSL_STATIC_FUNC(EVP_DigestSignFinal)>
       evp_digest_sign_final{"EVP_DigestSignFinal", *this};
 
+    ssl_api_function<
+      int(
+        evp_md_ctx_type*,
+        unsigned char*,
+        size_t*,
+        const unsigned char*,
+        size_t),
+      EAGINE_SSL_STATIC_FUNC(EVP_DigestSign)>
+      evp_digest_sign{"EVP_DigestSign", *this};
+
     ssl_api_function<
       int(
         evp_md_ctx_type*,
@@ -503,6 +699,54 @@ public:
       EAGINE_SSL_STATIC_FUNC(EVP_DigestVerifyFinal)>
       evp_digest_verify_final{"EVP_DigestVerifyFinal", *this};
 
+    ssl_api_function<
+      int(
+        evp_md_ctx_type*,
+        const unsigned char*,
+        size_t,
+        const unsigned char*,
+        size_t),
+      EAGINE_SSL_STATIC_FUNC(EVP_DigestVerify)>
+      evp_digest_verify{"EVP_DigestVerify", *this};
+
+    // kdf
+    ssl_api_function<
+      evp_kdf_type*(lib_ctx_type*, const char*, const char*),
+      EAGINE_SSL_STATIC_FUNC(EVP_KDF_fetch)>
+      evp_kdf_fetch{"EVP_KDF_fetch", *this};
+
+    ssl_api_function<void(evp_kdf_type*), EAGINE_SSL_STATIC_FUNC(EVP_KDF_free)>
+      evp_kdf_free{"EVP_KDF_free", *this};
+
+    ssl_api_function<
+      evp_kdf_ctx_type*(evp_kdf_type*),
+      EAGINE_SSL_STATIC_FUNC(EVP_KDF_CTX_new)>
+      evp_kdf_ctx_new{"EVP_KDF_CTX_new", *this};
+
+    ssl_api_function<
+      void(evp_kdf_ctx_type*),
+      EAGINE_SSL_STATIC_FUNC(EVP_KDF_CTX_free)>
+      evp_kdf_ctx_free{"EVP_KDF_CTX_free", *this};
+
+    ssl_api_function<
+      void(evp_kdf_ctx_type*),
+      EAGINE_SSL_STATIC_FUNC(EVP_KDF_CTX_reset)>
+      evp_kdf_ctx_reset{"EVP_KDF_CTX_reset", *this};
+
+    ssl_api_function<
+      int(evp_kdf_ctx_type*, unsigned char*, size_t, const param_type*),
+      EAGINE_SSL_STATIC_FUNC(EVP_KDF_derive)>
+      evp_kdf_derive{"EVP_KDF_derive", *this};
+
+    // mac
+    ssl_api_function<
+      evp_mac_type*(lib_ctx_type*, const char*, const char*),
+      EAGINE_SSL_STATIC_FUNC(EVP_MAC_fetch)>
+      evp_mac_fetch{"EVP_MAC_fetch", *this};
+
+    ssl_api_function<void(evp_mac_type*), EAGINE_SSL_STATIC_FUNC(EVP_MAC_free)>
+      evp_mac_free{"EVP_MAC_free", *this};
+
     // x509 lookup
     ssl_api_function<
       x509_lookup_method_type*(),
@@ -514,6 +758,16 @@ public:
       EAGINE_SSL_STATIC_FUNC(X509_LOOKUP_file)>
       x509_lookup_file{"X509_LOOKUP_file", *this};
 
+    ssl_api_function<
+      x509_lookup_type*(x509_store_type*, x509_lookup_method_type*),
+      EAGINE_SSL_STATIC_FUNC(X509_STORE_add_lookup)>
+      x509_store_add_lookup{"X509_STORE_add_lookup", *this};
+
+    ssl_api_function<
+      int(x509_lookup_type*, int, const char*, long, char**),
+      EAGINE_SSL_STATIC_FUNC(X509_LOOKUP_ctrl)>
+      x509_lookup_ctrl{"X509_LOOKUP_ctrl", *this};
+
     // x509 store context
     ssl_api_function<
       x509_store_ctx_type*(),
@@ -552,11 +806,66 @@ public:
       EAGINE_SSL_STATIC_FUNC(X509_STORE_CTX_free)>
       x509_store_ctx_free{"X509_STORE_CTX_free", *this};
 
+    ssl_api_function<
+      int(x509_store_ctx_type*, int),
+      EAGINE_SSL_STATIC_FUNC(X509_STORE_CTX_set_purpose)>
+      x509_store_ctx_set_purpose{"X509_STORE_CTX_set_purpose", *this};
+
+    ssl_api_function<
+      void(x509_store_ctx_type*, unsigned long),
+      EAGINE_SSL_STATIC_FUNC(X509_STORE_CTX_set_flags)>
+      x509_store_ctx_set_flags{"X509_STORE_CTX_set_flags", *this};
+
+    ssl_api_function<
+      void(x509_store_ctx_type*, unsigned long, std::time_t),
+      EAGINE_SSL_STATIC_FUNC(X509_STORE_CTX_set_time)>
+      x509_store_ctx_set_time{"X509_STORE_CTX_set_time", *this};
+
+    ssl_api_function<
+      void(x509_store_ctx_type*, int),
+      EAGINE_SSL_STATIC_FUNC(X509_STORE_CTX_set_depth)>
+      x509_store_ctx_set_depth{"X509_STORE_CTX_set_depth", *this};
+
+    ssl_api_function<
+      int(const x509_store_ctx_type*),
+      EAGINE_SSL_STATIC_FUNC(X509_STORE_CTX_get_error)>
+      x509_store_ctx_get_error{"X509_STORE_CTX_get_error", *this};
+
+    ssl_api_function<
+      int(const x509_store_ctx_type*),
+      EAGINE_SSL_STATIC_FUNC(X509_STORE_CTX_get_error_depth)>
+      x509_store_ctx_get_error_depth{"X509_STORE_CTX_get_error_depth", *this};
+
+    ssl_api_function<
+      void(x509_store_ctx_type*, int),
+      EAGINE_SSL_STATIC_FUNC(X509_STORE_CTX_set_error)>
+      x509_store_ctx_set_error{"X509_STORE_CTX_set_error", *this};
+
+    ssl_api_function<
+      x509_type*(const x509_store_ctx_type*),
+      EAGINE_SSL_STATIC_FUNC(X509_STORE_CTX_get_current_cert)>
+      x509_store_ctx_get_current_cert{"X509_STORE_CTX_get_current_cert", *this};
+
+    ssl_api_function<
+      void(x509_store_ctx_type*, x509_store_ctx_verify_callback_type*),
+      EAGINE_SSL_STATIC_FUNC(X509_STORE_CTX_set_verify_cb)>
+      x509_store_ctx_set_verify_cb{"X509_STORE_CTX_set_verify_cb", *this};
+
+    ssl_api_function<
+      int(x509_store_ctx_type*, int, void*),
+      EAGINE_SSL_STATIC_FUNC(X509_STORE_CTX_set_ex_data)>
+      x509_store_ctx_set_ex_data{"X509_STORE_CTX_set_ex_data", *this};
+
     ssl_api_function<
       int(x509_store_ctx_type*),
       EAGINE_SSL_STATIC_FUNC(X509_verify_cert)>
       x509_verify_cert{"X509_verify_cert", *this};
 
+    ssl_api_function<
+      const char*(long),
+      EAGINE_SSL_STATIC_FUNC(X509_verify_cert_error_string)>
+      x509_verify_cert_error_string{"X509_verify_cert_error_string", *this};
+
     // x509 store
     ssl_api_function<x509_store_type*(), EAGINE_SSL_STATIC_FUNC(X509_STORE_new)>
       x509_store_new{"X509_STORE_new", *this};
@@ -573,6 +882,11 @@ public:
     ssl_api_function<void(x509_store_type*), EAGINE_SSL_STATIC_FUNC(X509_STORE_free)>
       x509_store_free{"X509_STORE_free", *this};
 
+    ssl_api_function<
+      int(x509_store_type*, unsigned long),
+      EAGINE_SSL_STATIC_FUNC(X509_STORE_set_flags)>
+      x509_store_set_flags{"X509_STORE_set_flags", *this};
+
     ssl_api_function<
       int(x509_store_type*, x509_type*),
       EAGINE_SSL_STATIC_FUNC(X509_STORE_add_cert)>
@@ -630,6 +944,54 @@ public:
       EAGINE_SSL_STATIC_FUNC(X509_get_ext_count)>
       x509_get_ext_count{"X509_get_ext_count", *this};
 
+    ssl_api_function<int(x509_type*), EAGINE_SSL_STATIC_FUNC(X509_check_ca)>
+      x509_check_ca{"X509_check_ca", *this};
+
+    ssl_api_function<
+      unsigned long(x509_type*),
+      EAGINE_SSL_STATIC_FUNC(X509_issuer_name_hash)>
+      x509_issuer_name_hash{"X509_issuer_name_hash", *this};
+
+    ssl_api_function<
+      int(x509_type*, x509_type*),
+      EAGINE_SSL_STATIC_FUNC(X509_check_issued)>
+      x509_check_issued{"X509_check_issued", *this};
+
+    ssl_api_function<
+      int(x509_type*, const char*, size_t, unsigned, char**),
+      EAGINE_SSL_STATIC_FUNC(X509_check_host)>
+      x509_check_host{"X509_check_host", *this};
+
+    ssl_api_function<
+      int(x509_type*, const unsigned char*, size_t, unsigned),
+      EAGINE_SSL_STATIC_FUNC(X509_check_ip)>
+      x509_check_ip{"X509_check_ip", *this};
+
+    ssl_api_function<
+      int(x509_type*, const char*, unsigned),
+      EAGINE_SSL_STATIC_FUNC(X509_check_ip_asc)>
+      x509_check_ip_asc{"X509_check_ip_asc", *this};
+
+    ssl_api_function<
+      int(const x509_type*, const x509_type*),
+      EAGINE_SSL_STATIC_FUNC(X509_cmp)>
+      x509_cmp{"X509_cmp", *this};
+
+    ssl_api_function<
+      unsigned long(x509_type*),
+      EAGINE_SSL_STATIC_FUNC(X509_subject_name_hash)>
+      x509_subject_name_hash{"X509_subject_name_hash", *this};
+
+    ssl_api_function<
+      int(const x509_type*, const evp_md_type*, unsigned char*, unsigned*),
+      EAGINE_SSL_STATIC_FUNC(X509_digest)>
+      x509_digest{"X509_digest", *this};
+
+    ssl_api_function<
+      int(const x509_type*, const evp_md_type*, unsigned char*, unsigned*),
+      EAGINE_SSL_STATIC_FUNC(X509_pubkey_digest)>
+      x509_pubkey_digest{"X509_pubkey_digest", *this};
+
     ssl_api_function<void(x509_type*), EAGINE_SSL_STATIC_FUNC(X509_free)> x509_free{
       "X509_free",
       *this};
@@ -655,6 +1017,94 @@ public:
       EAGINE_SSL_STATIC_FUNC(X509_NAME_ENTRY_get_data)>
       x509_name_entry_get_data{"X509_NAME_ENTRY_get_data", *this};
 
+    // ocsp
+    ssl_api_function<ocsp_request_type*(), EAGINE_SSL_STATIC_FUNC(OCSP_REQUEST_new)>
+      ocsp_request_new{"OCSP_REQUEST_new", *this};
+
+    ssl_api_function<
+      void(ocsp_request_type*),
+      EAGINE_SSL_STATIC_FUNC(OCSP_REQUEST_free)>
+      ocsp_request_free{"OCSP_REQUEST_free", *this};
+
+    ssl_api_function<
+      ocsp_cert_id_type*(const evp_md_type*, const x509_type*, const x509_type*),
+      EAGINE_SSL_STATIC_FUNC(OCSP_cert_to_id)>
+      ocsp_cert_to_id{"OCSP_cert_to_id", *this};
+
+    ssl_api_function<
+      ocsp_cert_id_type*(const ocsp_cert_id_type*),
+      EAGINE_SSL_STATIC_FUNC(OCSP_CERTID_dup)>
+      ocsp_cert_id_dup{"OCSP_CERTID_dup", *this};
+
+    ssl_api_function<
+      void(ocsp_cert_id_type*),
+      EAGINE_SSL_STATIC_FUNC(OCSP_CERTID_free)>
+      ocsp_cert_id_free{"OCSP_CERTID_free", *this};
+
+    ssl_api_function<
+      int(const ocsp_cert_id_type*, const ocsp_cert_id_type*),
+      EAGINE_SSL_STATIC_FUNC(OCSP_id_cmp)>
+      ocsp_id_cmp{"OCSP_id_cmp", *this};
+
+    ssl_api_function<
+      ocsp_one_request_type*(ocsp_request_type*, ocsp_cert_id_type*),
+      EAGINE_SSL_STATIC_FUNC(OCSP_request_add0_id)>
+      ocsp_request_add0_id{"OCSP_request_add0_id", *this};
+
+    ssl_api_function<
+      int(ocsp_request_type*, unsigned char*, int),
+      EAGINE_SSL_STATIC_FUNC(OCSP_request_add1_nonce)>
+      ocsp_request_add1_nonce{"OCSP_request_add1_nonce", *this};
+
+    ssl_api_function<
+      int(ocsp_request_type*, ocsp_basic_response_type*),
+      EAGINE_SSL_STATIC_FUNC(OCSP_check_nonce)>
+      ocsp_check_nonce{"OCSP_check_nonce", *this};
+
+    ssl_api_function<
+      void(ocsp_response_type*),
+      EAGINE_SSL_STATIC_FUNC(OCSP_RESPONSE_free)>
+      ocsp_response_free{"OCSP_RESPONSE_free", *this};
+
+    ssl_api_function<
+      int(ocsp_response_type*),
+      EAGINE_SSL_STATIC_FUNC(OCSP_response_status)>
+      ocsp_response_status{"OCSP_response_status", *this};
+
+    ssl_api_function<
+      ocsp_basic_response_type*(ocsp_response_type*),
+      EAGINE_SSL_STATIC_FUNC(OCSP_response_get1_basic)>
+      ocsp_response_get1_basic{"OCSP_response_get1_basic", *this};
+
+    ssl_api_function<
+      void(ocsp_basic_response_type*),
+      EAGINE_SSL_STATIC_FUNC(OCSP_BASICRESP_free)>
+      ocsp_basic_response_free{"OCSP_BASICRESP_free", *this};
+
+    ssl_api_function<
+      int(
+        ocsp_basic_response_type*,
+        x509_stack_type*,
+        x509_store_type*,
+        unsigned long),
+      EAGINE_SSL_STATIC_FUNC(OCSP_basic_verify)>
+      ocsp_basic_verify{"OCSP_basic_verify", *this};
+
+    ssl_api_function<
+      const char*(long),
+      EAGINE_SSL_STATIC_FUNC(OCSP_response_status_str)>
+      ocsp_response_status_str{"OCSP_response_status_str", *this};
+
+    ssl_api_function<
+      const char*(long),
+      EAGINE_SSL_STATIC_FUNC(OCSP_cert_status_str)>
+      ocsp_cert_status_str{"OCSP_cert_status_str", *this};
+
+    ssl_api_function<
+      const char*(long),
+      EAGINE_SSL_STATIC_FUNC(OCSP_crl_reason_str)>
+      ocsp_crl_reason_str{"OCSP_crl_reason_str", *this};
+
     // pem
     ssl_api_function<
       evp_pkey_type*(bio_type*, evp_pkey_type**, passwd_callback_type*, void*),
@@ -676,6 +1126,36 @@ public:
       EAGINE_SSL_STATIC_FUNC(PEM_read_bio_X509)>
       pem_read_bio_x509{"PEM_read_bio_X509", *this};
 
+    ssl_api_function<
+      int(
+        bio_type*,
+        const evp_pkey_type*,
+        const evp_cipher_type*,
+        const char*,
+        int,
+        passwd_callback_type*,
+        void*),
+      EAGINE_SSL_STATIC_FUNC(PEM_write_bio_PKCS8PrivateKey)>
+      pem_write_bio_pkcs8_private_key{"PEM_write_bio_PKCS8PrivateKey", *this};
+
+    // der
+    ssl_api_function<
+      x509_type*(bio_type*, x509_type**),
+      EAGINE_SSL_STATIC_FUNC(d2i_X509_bio)>
+      d2i_x509_bio{"d2i_X509_bio", *this};
+
+    ssl_api_function<
+      int(
+        bio_type*,
+        const evp_pkey_type*,
+        const evp_cipher_type*,
+        const char*,
+        int,
+        passwd_callback_type*,
+        void*),
+      EAGINE_SSL_STATIC_FUNC(i2d_PKCS8PrivateKey_bio)>
+      i2d_pkcs8_private_key_bio{"i2d_PKCS8PrivateKey_bio", *this};
+
     basic_ssl_c_api(api_traits& traits)
       : _traits{traits} {}
 
@@ -0,0 +1,336 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+export module eagine.sslplus:certificate_info;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+import eagine.core.utility;
+import :object_handle;
+import :conversions;
+import :subject_alt_names;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+/// @brief Bits of the X509 key usage extension.
+/// @see certificate_info::key_usage
+export enum class x509_key_usage : std::uint32_t {
+    digital_signature = 0x0080U,
+    non_repudiation = 0x0040U,
+    key_encipherment = 0x0020U,
+    data_encipherment = 0x0010U,
+    key_agreement = 0x0008U,
+    key_cert_sign = 0x0004U,
+    crl_sign = 0x0002U
+};
+
+/// @brief Bits of the X509 extended key usage extension.
+/// @see certificate_info::extended_key_usage
+export enum class x509_extended_key_usage : std::uint32_t {
+    ssl_server = 0x0001U,
+    ssl_client = 0x0002U,
+    smime = 0x0004U,
+    code_sign = 0x0008U,
+    ocsp_sign = 0x0020U,
+    timestamp = 0x0040U
+};
+//------------------------------------------------------------------------------
+/// @brief Pre-decoded entries of an X509 name.
+/// @see certificate_info
+///
+/// All entry names and values are stored in a single buffer.
+export class certificate_name {
+public:
+    /// @brief Construction of an empty name.
+    certificate_name() noexcept = default;
+
+    /// @brief Decodes all entries of the specified X509 name.
+    certificate_name(const x509_name name);
+
+    /// @brief Returns the number of entries.
+    auto size() const noexcept -> span_size_t {
+        return span_size(_entries.size());
+    }
+
+    /// @brief Returns the DER encoding of the whole name.
+    auto der() const noexcept -> memory::const_block {
+        return {
+          reinterpret_cast<const byte*>(_buffer.data()),
+          span_size(_der_size)};
+    }
+
+    /// @brief Returns the value of the first entry with the long or short name.
+    auto find(const string_view ent_name) const noexcept -> string_view {
+        const auto key{as_std_view(ent_name)};
+        for(const auto& entry : _entries) {
+            if((_long_name(entry) == key) or (_short_name(entry) == key)) {
+                return as_eagine_view(_value(entry));
+            }
+        }
+        return {};
+    }
+
+    /// @brief Returns the value of the first entry with the dotted OID.
+    auto find_oid(const string_view ent_oid) const noexcept -> string_view {
+        const auto key{as_std_view(ent_oid)};
+        for(const auto& entry : _entries) {
+            if(_oid(entry) == key) {
+                return as_eagine_view(_value(entry));
+            }
+        }
+        return {};
+    }
+
+    /// @brief Indicates if the entry with the specified name has the value.
+    auto has_entry_value(const string_view ent_name, const string_view value)
+      const noexcept -> bool {
+        return are_equal(find(ent_name), value);
+    }
+
+    /// @brief Calls the function with the long name, OID and value of each entry.
+    template <typename Function>
+    void for_each(Function func) const {
+        for(const auto& entry : _entries) {
+            func(
+              as_eagine_view(_long_name(entry)),
+              as_eagine_view(_oid(entry)),
+              as_eagine_view(_value(entry)));
+        }
+    }
+
+private:
+    struct entry_info {
+        std::uint32_t offset{0U};
+        std::uint16_t long_name_length{0U};
+        std::uint16_t short_name_length{0U};
+        std::uint16_t oid_length{0U};
+        std::uint16_t value_length{0U};
+    };
+
+    auto _part(const std::size_t offset, const std::size_t length)
+      const noexcept -> std::string_view {
+        return std::string_view{_buffer}.substr(offset, length);
+    }
+
+    auto _long_name(const entry_info& e) const noexcept -> std::string_view {
+        return _part(e.offset, e.long_name_length);
+    }
+
+    auto _short_name(const entry_info& e) const noexcept -> std::string_view {
+        return _part(e.offset + e.long_name_length, e.short_name_length);
+    }
+
+    auto _oid(const entry_info& e) const noexcept -> std::string_view {
+        return _part(
+          e.offset + e.long_name_length + e.short_name_length, e.oid_length);
+    }
+
+    auto _value(const entry_info& e) const noexcept -> std::string_view {
+        return _part(
+          e.offset + e.long_name_length + e.short_name_length + e.oid_length,
+          e.value_length);
+    }
+
+    void _add(
+      const std::string_view long_name,
+      const std::string_view short_name,
+      const std::string_view oid,
+      const std::string_view value);
+
+    std::string _buffer;
+    std::size_t _der_size{0U};
+    std::vector<entry_info> _entries;
+};
+//------------------------------------------------------------------------------
+/// @brief Immutable certificate metadata decoded once.
+/// @see make_certificate_info
+/// @see certificate_info_cache
+///
+/// Unlike the getters of basic_ssl_api, the accessors do not call into
+/// OpenSSL, do not allocate and do not require releasing the results,
+/// so a shared instance can be used concurrently from any thread.
+export class certificate_info {
+public:
+    /// @brief Decodes the metadata of the specified certificate.
+    certificate_info(const x509 cert);
+
+    /// @brief Returns the subject name.
+    auto subject() const noexcept -> const certificate_name& {
+        return _subject;
+    }
+
+    /// @brief Returns the issuer name.
+    auto issuer() const noexcept -> const certificate_name& {
+        return _issuer;
+    }
+
+    /// @brief Returns the content bytes of the serial number.
+    auto serial() const noexcept -> memory::const_block {
+        return {
+          reinterpret_cast<const byte*>(_serial.data()),
+          span_size(_serial.size())};
+    }
+
+    /// @brief Returns the start of the validity period.
+    auto not_before() const noexcept -> std::chrono::system_clock::time_point {
+        return _not_before;
+    }
+
+    /// @brief Returns the end of the validity period.
+    auto not_after() const noexcept -> std::chrono::system_clock::time_point {
+        return _not_after;
+    }
+
+    /// @brief Indicates if the certificate is valid at the specified time.
+    auto is_valid_at(const std::chrono::system_clock::time_point when)
+      const noexcept -> bool {
+        return (_not_before <= when) and (when <= _not_after);
+    }
+
+    /// @brief Returns the public key type name (RSA, EC, ED25519, ...).
+    auto key_type() const noexcept -> string_view {
+        return as_eagine_view(_key_type);
+    }
+
+    /// @brief Returns the public key size in bits.
+    auto key_bits() const noexcept -> int {
+        return _key_bits;
+    }
+
+    /// @brief Indicates if the certificate is a CA certificate.
+    auto is_ca() const noexcept -> bool {
+        return _is_ca;
+    }
+
+    /// @brief Returns the key usage bits or all bits if unrestricted.
+    auto key_usage() const noexcept -> std::uint32_t {
+        return _key_usage;
+    }
+
+    /// @brief Indicates if the key usage allows the specified use.
+    auto allows(const x509_key_usage usage) const noexcept -> bool {
+        return (_key_usage & std::to_underlying(usage)) != 0U;
+    }
+
+    /// @brief Returns the extended key usage bits or all bits if unrestricted.
+    auto extended_key_usage() const noexcept -> std::uint32_t {
+        return _extended_key_usage;
+    }
+
+    /// @brief Indicates if the extended key usage allows the specified use.
+    auto allows(const x509_extended_key_usage usage) const noexcept -> bool {
+        return (_extended_key_usage & std::to_underlying(usage)) != 0U;
+    }
+
+    /// @brief Returns the subject alternative names.
+    auto alt_names() const noexcept -> const subject_alt_names& {
+        return _alt_names;
+    }
+
+    /// @brief Returns the SHA-256 fingerprint of the DER encoded certificate.
+    /// @note Empty if the fingerprint could not be computed.
+    auto fingerprint() const noexcept -> memory::const_block {
+        return {_fingerprint.data(), span_size(_fingerprint_size)};
+    }
+
+private:
+    certificate_name _subject;
+    certificate_name _issuer;
+    subject_alt_names _alt_names;
+    std::string _serial;
+    std::string _key_type;
+    std::chrono::system_clock::time_point _not_before{};
+    std::chrono::system_clock::time_point _not_after{};
+    std::uint32_t _key_usage{~std::uint32_t(0U)};
+    std::uint32_t _extended_key_usage{~std::uint32_t(0U)};
+    int _key_bits{0};
+    bool _is_ca{false};
+    std::array<byte, 32> _fingerprint{};
+    std::uint8_t _fingerprint_size{0U};
+};
+
+/// @brief Alias for shared pointer to immutable certificate_info.
+export using certificate_info_ptr = std::shared_ptr<const certificate_info>;
+
+/// @brief Decodes the metadata of a certificate into a shareable object.
+export auto make_certificate_info(const x509 cert) -> certificate_info_ptr {
+    if(cert) {
+        return std::make_shared<const certificate_info>(cert);
+    }
+    return {};
+}
+//------------------------------------------------------------------------------
+/// @brief Returns the SHA-256 digest of the DER encoding of a certificate.
+/// @note Returns nothing if the digest could not be computed.
+export auto get_x509_sha256_digest(const x509 cert) noexcept
+  -> std::optional<std::array<byte, 32>>;
+//------------------------------------------------------------------------------
+/// @brief Thread-safe cache of decoded certificate metadata.
+/// @see certificate_info
+///
+/// The entries are keyed by the SHA-256 digest of the certificate, so that
+/// a SHA-1 collision cannot return the metadata of another certificate.
+/// A parsed certificate keeps its DER encoding, so a lookup only hashes it.
+/// Certificates without a digest are decoded, but not cached.
+export class certificate_info_cache {
+public:
+    /// @brief Construction with the maximum number of cached entries.
+    certificate_info_cache(const span_size_t capacity = 1024) noexcept
+      : _capacity{std_size(capacity)} {}
+
+    /// @brief Returns the cached metadata, decoding them on the first use.
+    auto get(const x509 cert) -> certificate_info_ptr {
+        if(not cert) {
+            return {};
+        }
+        const auto found_key{_key_of(cert)};
+        if(not found_key) {
+            return make_certificate_info(cert);
+        }
+        const auto& key{*found_key};
+        {
+            const std::shared_lock lock{_mutex};
+            if(const auto pos{_infos.find(key)}; pos != _infos.end()) {
+                return pos->second;
+            }
+        }
+        auto info{make_certificate_info(cert)};
+        const std::unique_lock lock{_mutex};
+        if((_infos.size() >= _capacity) and not _infos.contains(key)) {
+            _infos.erase(_infos.begin());
+        }
+        return _infos.try_emplace(key, std::move(info)).first->second;
+    }
+
+    /// @brief Returns the number of cached entries.
+    auto size() const noexcept -> span_size_t {
+        const std::shared_lock lock{_mutex};
+        return span_size(_infos.size());
+    }
+
+    /// @brief Removes all cached entries.
+    void clear() noexcept {
+        const std::unique_lock lock{_mutex};
+        _infos.clear();
+    }
+
+private:
+    static auto _key_of(const x509 cert) -> std::optional<std::string> {
+        if(const auto hash{get_x509_sha256_digest(cert)}) {
+            return std::string{
+              reinterpret_cast<const char*>(hash->data()), hash->size()};
+        }
+        return {};
+    }
+
+    const std::size_t _capacity;
+    mutable std::shared_mutex _mutex;
+    std::unordered_map<std::string, certificate_info_ptr> _infos;
+};
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
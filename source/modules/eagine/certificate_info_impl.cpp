@@ -0,0 +1,163 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+module;
+
+#if __has_include(<openssl/x509v3.h>)
+#include <openssl/asn1.h>
+#include <openssl/evp.h>
+#include <openssl/objects.h>
+#include <openssl/x509.h>
+#include <openssl/x509v3.h>
+
+#define EAGINE_HAS_SSL 1
+#else
+#define EAGINE_HAS_SSL 0
+#endif
+
+module eagine.sslplus;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+#if EAGINE_HAS_SSL
+static_assert(
+  std::to_underlying(x509_key_usage::digital_signature) == KU_DIGITAL_SIGNATURE);
+static_assert(
+  std::to_underlying(x509_key_usage::key_cert_sign) == KU_KEY_CERT_SIGN);
+static_assert(std::to_underlying(x509_key_usage::crl_sign) == KU_CRL_SIGN);
+static_assert(
+  std::to_underlying(x509_extended_key_usage::ssl_server) == XKU_SSL_SERVER);
+static_assert(
+  std::to_underlying(x509_extended_key_usage::ocsp_sign) == XKU_OCSP_SIGN);
+
+static auto as_text(const ASN1_STRING* str) noexcept -> std::string_view {
+    if(str) {
+        return {
+          reinterpret_cast<const char*>(ASN1_STRING_get0_data(str)),
+          std_size(ASN1_STRING_length(str))};
+    }
+    return {};
+}
+#endif
+//------------------------------------------------------------------------------
+// certificate_name
+//------------------------------------------------------------------------------
+certificate_name::certificate_name([[maybe_unused]] const x509_name name) {
+#if EAGINE_HAS_SSL
+    const auto* native{static_cast<const X509_NAME*>(name)};
+    if(not native) {
+        return;
+    }
+    const unsigned char* der{nullptr};
+    std::size_t der_size{0U};
+    if(X509_NAME_get0_der(native, &der, &der_size)) {
+        _buffer.append(reinterpret_cast<const char*>(der), der_size);
+        _der_size = der_size;
+    }
+    const auto count{X509_NAME_entry_count(native)};
+    _entries.reserve(std_size(count));
+    std::array<char, 128> oid{};
+    for(int index = 0; index < count; ++index) {
+        const auto* entry{X509_NAME_get_entry(native, index)};
+        const auto* object{X509_NAME_ENTRY_get_object(entry)};
+        const auto nid{OBJ_obj2nid(object)};
+        const auto oid_length{
+          OBJ_obj2txt(oid.data(), int(oid.size()), object, 1)};
+        const auto* long_name{nid != NID_undef ? OBJ_nid2ln(nid) : nullptr};
+        const auto* short_name{nid != NID_undef ? OBJ_nid2sn(nid) : nullptr};
+        _add(
+          long_name ? std::string_view{long_name} : std::string_view{},
+          short_name ? std::string_view{short_name} : std::string_view{},
+          std::string_view{
+            oid.data(),
+            std::min(std_size(std::max(oid_length, 0)), oid.size() - 1U)},
+          as_text(X509_NAME_ENTRY_get_data(entry)));
+    }
+#endif
+}
+//------------------------------------------------------------------------------
+void certificate_name::_add(
+  const std::string_view long_name,
+  const std::string_view short_name,
+  const std::string_view oid,
+  const std::string_view value) {
+    const auto limited{[](std::string_view s) {
+        return s.substr(0, 0xFFFFU);
+    }};
+    const entry_info entry{
+      .offset = static_cast<std::uint32_t>(_buffer.size()),
+      .long_name_length = static_cast<std::uint16_t>(limited(long_name).size()),
+      .short_name_length =
+        static_cast<std::uint16_t>(limited(short_name).size()),
+      .oid_length = static_cast<std::uint16_t>(limited(oid).size()),
+      .value_length = static_cast<std::uint16_t>(limited(value).size())};
+    _buffer.append(limited(long_name))
+      .append(limited(short_name))
+      .append(limited(oid))
+      .append(limited(value));
+    _entries.push_back(entry);
+}
+//------------------------------------------------------------------------------
+// certificate_info
+//------------------------------------------------------------------------------
+certificate_info::certificate_info([[maybe_unused]] const x509 cert) {
+#if EAGINE_HAS_SSL
+    auto* native{static_cast<X509*>(cert)};
+    if(not native) {
+        return;
+    }
+    _subject = certificate_name{x509_name{X509_get_subject_name(native)}};
+    _issuer = certificate_name{x509_name{X509_get_issuer_name(native)}};
+    _alt_names = subject_alt_names{cert};
+    _serial = as_text(X509_get0_serialNumber(native));
+    _not_before = as_time_point(asn1_string{X509_get0_notBefore(native)})
+                    .value_or(std::chrono::system_clock::time_point{});
+    _not_after = as_time_point(asn1_string{X509_get0_notAfter(native)})
+                   .value_or(std::chrono::system_clock::time_point{});
+
+    if(const auto* key{X509_get0_pubkey(native)}) {
+        if(const auto* type_name{EVP_PKEY_get0_type_name(key)}) {
+            _key_type = type_name;
+        }
+        _key_bits = EVP_PKEY_get_bits(key);
+    }
+
+    // also caches the decoded extensions in the certificate
+    const auto flags{X509_get_extension_flags(native)};
+    _is_ca = (flags & EXFLAG_CA) != 0U;
+    _key_usage = X509_get_key_usage(native);
+    _extended_key_usage = X509_get_extended_key_usage(native);
+
+    unsigned size{0U};
+    if(X509_digest(native, EVP_sha256(), _fingerprint.data(), &size)) {
+        _fingerprint_size = static_cast<std::uint8_t>(size);
+    }
+#endif
+}
+//------------------------------------------------------------------------------
+auto get_x509_sha256_digest([[maybe_unused]] const x509 cert) noexcept
+  -> std::optional<std::array<byte, 32>> {
+#if EAGINE_HAS_SSL
+    if(cert) {
+        std::array<byte, 32> result{};
+        unsigned size{0U};
+        if(
+          X509_digest(
+            static_cast<X509*>(cert), EVP_sha256(), result.data(), &size) and
+          (size == result.size())) {
+            return result;
+        }
+    }
+#endif
+    return {};
+}
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
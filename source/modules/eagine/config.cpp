@@ -23,17 +23,29 @@ struct bio_method_st;
 struct engine_st;
 struct evp_cipher_ctx_st;
 struct evp_cipher_st;
+struct evp_kdf_st;
+struct evp_kdf_ctx_st;
+struct evp_mac_st;
 struct evp_md_st;
 struct evp_md_ctx_st;
 struct evp_pkey_ctx_st;
 struct evp_pkey_st;
+struct ocsp_basic_response_st;
+struct ocsp_cert_id_st;
+struct ocsp_one_request_st;
+struct ocsp_request_st;
+struct ocsp_response_st;
 struct ossl_core_handle_st;
 struct ossl_dispatch_st;
 struct ossl_lib_ctx_st;
+struct ossl_param_st;
+struct ossl_param_bld_st;
 struct ossl_provider_st;
 struct ui_st;
 struct ui_method_st;
 struct x509_st;
+struct X509_extension_st;
+struct GENERAL_NAME_st;
 struct X509_crl_st;
 struct x509_lookup_method_st;
 struct x509_lookup_st;
@@ -43,6 +55,10 @@ struct x509_store_ctx_st;
 struct x509_store_st;
 //
 struct stack_st_X509;
+struct stack_st_X509_CRL;
+struct stack_st_X509_EXTENSION;
+struct stack_st_GENERAL_NAME;
+struct stack_st_X509_NAME_ENTRY;
 }
 
 namespace eagine::sslplus {
@@ -57,6 +73,8 @@ export struct ssl_types {
     using dispatch_type = ::ossl_dispatch_st;
     using core_handle_type = ::ossl_core_handle_st;
     using lib_ctx_type = ::ossl_lib_ctx_st;
+    using param_type = ::ossl_param_st;
+    using param_bld_type = ::ossl_param_bld_st;
     using provider_type = ::ossl_provider_st;
     using engine_type = ::engine_st;
     using asn1_object_type = ::asn1_object_st;
@@ -68,9 +86,19 @@ export struct ssl_types {
     using evp_pkey_type = ::evp_pkey_st;
     using evp_cipher_ctx_type = ::evp_cipher_ctx_st;
     using evp_cipher_type = ::evp_cipher_st;
+    using evp_kdf_ctx_type = ::evp_kdf_ctx_st;
+    using evp_kdf_type = ::evp_kdf_st;
+    using evp_mac_type = ::evp_mac_st;
     using evp_md_ctx_type = ::evp_md_ctx_st;
     using evp_md_type = ::evp_md_st;
+    using ocsp_basic_response_type = ::ocsp_basic_response_st;
+    using ocsp_cert_id_type = ::ocsp_cert_id_st;
+    using ocsp_one_request_type = ::ocsp_one_request_st;
+    using ocsp_request_type = ::ocsp_request_st;
+    using ocsp_response_type = ::ocsp_response_st;
+    using general_name_type = ::GENERAL_NAME_st;
     using x509_crl_type = ::X509_crl_st;
+    using x509_extension_type = ::X509_extension_st;
     using x509_lookup_method_type = ::x509_lookup_method_st;
     using x509_lookup_type = ::x509_lookup_st;
     using x509_name_type = ::X509_name_st;
@@ -79,6 +107,10 @@ export struct ssl_types {
     using x509_store_type = ::x509_store_st;
     using x509_type = ::x509_st;
     using x509_stack_type = ::stack_st_X509;
+    using x509_crl_stack_type = ::stack_st_X509_CRL;
+    using x509_extension_stack_type = ::stack_st_X509_EXTENSION;
+    using general_name_stack_type = ::stack_st_GENERAL_NAME;
+    using x509_name_entry_stack_type = ::stack_st_X509_NAME_ENTRY;
 };
 //------------------------------------------------------------------------------
 } // namespace eagine::sslplus
@@ -5,6 +5,18 @@
 /// See accompanying file LICENSE_1_0.txt or copy at
 /// https://www.boost.org/LICENSE_1_0.txt
 ///
+module;
+
+#if __has_include(<openssl/x509_vfy.h>) && __has_include(<openssl/x509v3.h>)
+#include <openssl/ocsp.h>
+#include <openssl/x509_vfy.h>
+#include <openssl/x509v3.h>
+
+#define EAGINE_HAS_SSL 1
+#else
+#define EAGINE_HAS_SSL 0
+#endif
+
 export module eagine.sslplus:constants;
 
 import :c_api;
@@ -15,6 +27,74 @@ export template <typename ApiTraits>
 struct basic_ssl_constants {
 public:
     basic_ssl_constants(ApiTraits&, basic_ssl_c_api<ApiTraits>&) {}
+
+#if EAGINE_HAS_SSL
+    // x509 purpose
+    static constexpr const int x509_purpose_ssl_client{X509_PURPOSE_SSL_CLIENT};
+    static constexpr const int x509_purpose_ssl_server{X509_PURPOSE_SSL_SERVER};
+    static constexpr const int x509_purpose_smime_sign{X509_PURPOSE_SMIME_SIGN};
+    static constexpr const int x509_purpose_any{X509_PURPOSE_ANY};
+
+    // x509 verification flags
+    static constexpr const unsigned long x509_v_flag_partial_chain{
+      X509_V_FLAG_PARTIAL_CHAIN};
+    static constexpr const unsigned long x509_v_flag_x509_strict{
+      X509_V_FLAG_X509_STRICT};
+    static constexpr const unsigned long x509_v_flag_no_check_time{
+      X509_V_FLAG_NO_CHECK_TIME};
+    static constexpr const unsigned long x509_v_flag_crl_check{
+      X509_V_FLAG_CRL_CHECK};
+    static constexpr const unsigned long x509_v_flag_crl_check_all{
+      X509_V_FLAG_CRL_CHECK_ALL};
+
+    // x509 lookup
+    static constexpr const int x509_l_add_dir{X509_L_ADD_DIR};
+    static constexpr const long x509_filetype_pem{X509_FILETYPE_PEM};
+
+    // x509 host, ip and email check flags
+    static constexpr const unsigned x509_check_flag_no_wildcards{
+      X509_CHECK_FLAG_NO_WILDCARDS};
+    static constexpr const unsigned x509_check_flag_no_partial_wildcards{
+      X509_CHECK_FLAG_NO_PARTIAL_WILDCARDS};
+    static constexpr const unsigned x509_check_flag_never_check_subject{
+      X509_CHECK_FLAG_NEVER_CHECK_SUBJECT};
+
+    // x509 verification errors
+    static constexpr const int x509_v_err_unable_to_get_issuer_cert{
+      X509_V_ERR_UNABLE_TO_GET_ISSUER_CERT};
+    static constexpr const int x509_v_err_unable_to_get_issuer_cert_locally{
+      X509_V_ERR_UNABLE_TO_GET_ISSUER_CERT_LOCALLY};
+    static constexpr const int x509_v_err_application_verification{
+      X509_V_ERR_APPLICATION_VERIFICATION};
+
+    // ocsp
+    static constexpr const int ocsp_response_status_successful{
+      OCSP_RESPONSE_STATUS_SUCCESSFUL};
+#else
+    static constexpr const int x509_purpose_ssl_client{0};
+    static constexpr const int x509_purpose_ssl_server{0};
+    static constexpr const int x509_purpose_smime_sign{0};
+    static constexpr const int x509_purpose_any{0};
+
+    static constexpr const unsigned long x509_v_flag_partial_chain{0UL};
+    static constexpr const unsigned long x509_v_flag_x509_strict{0UL};
+    static constexpr const unsigned long x509_v_flag_no_check_time{0UL};
+    static constexpr const unsigned long x509_v_flag_crl_check{0UL};
+    static constexpr const unsigned long x509_v_flag_crl_check_all{0UL};
+
+    static constexpr const int x509_l_add_dir{2};
+    static constexpr const long x509_filetype_pem{1L};
+
+    static constexpr const unsigned x509_check_flag_no_wildcards{0U};
+    static constexpr const unsigned x509_check_flag_no_partial_wildcards{0U};
+    static constexpr const unsigned x509_check_flag_never_check_subject{0U};
+
+    static constexpr const int x509_v_err_unable_to_get_issuer_cert{2};
+    static constexpr const int x509_v_err_unable_to_get_issuer_cert_locally{20};
+    static constexpr const int x509_v_err_application_verification{50};
+
+    static constexpr const int ocsp_response_status_successful{0};
+#endif
 };
 //------------------------------------------------------------------------------
 } // namespace eagine::sslplus
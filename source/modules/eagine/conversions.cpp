@@ -0,0 +1,33 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+export module eagine.sslplus:conversions;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+import :object_handle;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+auto as_std_view(const string_view s) noexcept -> std::string_view {
+    return {s.data(), std_size(s.size())};
+}
+
+auto as_std_view(const memory::const_block blk) noexcept -> std::string_view {
+    return {reinterpret_cast<const char*>(blk.data()), std_size(blk.size())};
+}
+
+auto as_eagine_view(const std::string_view s) noexcept -> string_view {
+    return {s.data(), span_size(s.size())};
+}
+//------------------------------------------------------------------------------
+// returns nothing if the ASN1 time or generalized time is empty or invalid
+auto as_time_point(const asn1_string when) noexcept
+  -> std::optional<std::chrono::system_clock::time_point>;
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
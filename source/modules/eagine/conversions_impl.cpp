@@ -0,0 +1,47 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+module;
+
+#if __has_include(<openssl/asn1.h>)
+#include <openssl/asn1.h>
+
+#define EAGINE_HAS_SSL 1
+#else
+#define EAGINE_HAS_SSL 0
+#endif
+
+module eagine.sslplus;
+
+import std;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+auto as_time_point([[maybe_unused]] const asn1_string when) noexcept
+  -> std::optional<std::chrono::system_clock::time_point> {
+#if EAGINE_HAS_SSL
+    if(when) {
+        // the difference from the epoch avoids the non-portable timegm
+        static const std::unique_ptr<ASN1_TIME, void (*)(ASN1_TIME*)> epoch{
+          ASN1_TIME_set(nullptr, 0), &ASN1_TIME_free};
+        int days{0};
+        int seconds{0};
+        if(
+          epoch and ASN1_TIME_diff(
+                      &days,
+                      &seconds,
+                      epoch.get(),
+                      static_cast<const ASN1_TIME*>(when))) {
+            return std::chrono::system_clock::time_point{
+              std::chrono::days{days} + std::chrono::seconds{seconds}};
+        }
+    }
+#endif
+    return {};
+}
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
@@ -0,0 +1,288 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+export module eagine.sslplus:crl;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+import eagine.core.utility;
+import eagine.core.c_api;
+import :api_traits;
+import :object_handle;
+import :conversions;
+import :api;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+/// @brief Returns the DER encoding of the issuer name of a certificate.
+/// @note The returned block is owned by the certificate.
+export auto get_x509_issuer_der(const x509 cert) noexcept
+  -> memory::const_block;
+
+/// @brief Returns the content bytes of the serial number of a certificate.
+/// @note The returned block is owned by the certificate.
+export auto get_x509_serial_bytes(const x509 cert) noexcept
+  -> memory::const_block;
+
+/// @brief Returns the DER encoding of the issuer name of a CRL.
+/// @note The returned block is owned by the CRL.
+export auto get_x509_crl_issuer_der(const x509_crl crl) noexcept
+  -> memory::const_block;
+
+/// @brief Returns the time of the last update of a CRL.
+export auto get_x509_crl_last_update(const x509_crl crl) noexcept
+  -> std::chrono::system_clock::time_point;
+
+/// @brief Returns the time of the next update of a CRL, if specified.
+export auto get_x509_crl_next_update(const x509_crl crl) noexcept
+  -> std::optional<std::chrono::system_clock::time_point>;
+
+/// @brief Indicates if a CRL is signed by a CRL issuer certificate in the store.
+/// @note The issuer certificate must allow signing CRLs in its key usage.
+export auto verify_x509_crl_signature(
+  const x509_crl crl,
+  const x509_store trusted) noexcept -> bool;
+
+/// @brief Appends the serial number bytes of all entries revoked by a CRL.
+export void collect_revoked_serials(
+  const x509_crl crl,
+  std::vector<std::string>& serials);
+//------------------------------------------------------------------------------
+struct revocation_key_hash {
+    using is_transparent = void;
+
+    auto operator()(const std::string_view key) const noexcept -> std::size_t {
+        return std::hash<std::string_view>{}(key);
+    }
+};
+//------------------------------------------------------------------------------
+/// @brief Immutable set of serial numbers revoked by a single issuer.
+/// @see revocation_snapshot
+export class issuer_revocations {
+public:
+    issuer_revocations(
+      const std::chrono::system_clock::time_point last_update,
+      const std::optional<std::chrono::system_clock::time_point> next_update,
+      std::vector<std::string> serials)
+      : _last_update{last_update}
+      , _next_update{next_update} {
+        _serials.reserve(serials.size());
+        for(auto& serial : serials) {
+            _serials.insert(std::move(serial));
+        }
+    }
+
+    /// @brief Returns the last update time of the indexed CRL.
+    auto last_update() const noexcept -> std::chrono::system_clock::time_point {
+        return _last_update;
+    }
+
+    /// @brief Returns the next update time of the indexed CRL, if specified.
+    auto next_update() const noexcept
+      -> std::optional<std::chrono::system_clock::time_point> {
+        return _next_update;
+    }
+
+    /// @brief Indicates if the indexed CRL is past its next update time.
+    auto is_expired(const std::chrono::system_clock::time_point now)
+      const noexcept -> bool {
+        return _next_update and (*_next_update < now);
+    }
+
+    /// @brief Returns the number of revoked serial numbers.
+    auto size() const noexcept -> span_size_t {
+        return span_size(_serials.size());
+    }
+
+    /// @brief Indicates if the specified serial number is revoked.
+    auto contains(const memory::const_block serial) const noexcept -> bool {
+        return _serials.find(as_std_view(serial)) != _serials.end();
+    }
+
+private:
+    std::chrono::system_clock::time_point _last_update;
+    std::optional<std::chrono::system_clock::time_point> _next_update;
+    std::unordered_set<std::string, revocation_key_hash, std::equal_to<>>
+      _serials;
+};
+//------------------------------------------------------------------------------
+export template <typename ApiTraits>
+class basic_crl_index;
+//------------------------------------------------------------------------------
+/// @brief Immutable snapshot of the revocation information of all issuers.
+/// @see basic_crl_index
+export class revocation_snapshot {
+public:
+    /// @brief Returns the number of indexed issuers.
+    auto issuer_count() const noexcept -> span_size_t {
+        return span_size(_issuers.size());
+    }
+
+    /// @brief Returns the revocations of the issuer with the DER encoded name.
+    auto find(const memory::const_block issuer) const noexcept
+      -> const issuer_revocations* {
+        const auto pos{_issuers.find(as_std_view(issuer))};
+        if(pos != _issuers.end()) {
+            return pos->second.get();
+        }
+        return nullptr;
+    }
+
+    /// @brief Indicates if the issuer of the certificate revoked it.
+    /// @note Certificates of issuers without an indexed CRL are not revoked.
+    auto is_revoked(const x509 cert) const noexcept -> bool {
+        if(const auto revocations{find(get_x509_issuer_der(cert))}) {
+            return revocations->contains(get_x509_serial_bytes(cert));
+        }
+        return false;
+    }
+
+private:
+    template <typename>
+    friend class basic_crl_index;
+
+    std::unordered_map<
+      std::string,
+      std::shared_ptr<const issuer_revocations>,
+      revocation_key_hash,
+      std::equal_to<>>
+      _issuers;
+};
+//------------------------------------------------------------------------------
+/// @brief Index of revoked certificate serial numbers per CRL issuer.
+/// @see revocation_snapshot
+///
+/// Lookups work on an immutable snapshot, updates build a new snapshot
+/// sharing the revocations of unchanged issuers and replace the current
+/// one atomically, so reloading a large CRL does not block lookups.
+/// Only CRLs signed by an issuer in the trusted store and not past their
+/// next update are indexed, and the CRL of an issuer is replaced only by
+/// a CRL with a newer last update, so that a forged or stale CRL cannot
+/// un-revoke certificates.
+export template <typename ApiTraits>
+class basic_crl_index {
+public:
+    basic_crl_index(
+      const basic_ssl_api<ApiTraits>& ssl,
+      const std::chrono::seconds max_clock_skew = std::chrono::minutes{5})
+      : _ssl{ssl}
+      , _max_clock_skew{max_clock_skew}
+      , _current{std::make_shared<const revocation_snapshot>()} {}
+
+    /// @brief Returns the current snapshot of the index.
+    auto snapshot() const noexcept -> std::shared_ptr<const revocation_snapshot> {
+        const std::lock_guard lock{_current_mutex};
+        return _current;
+    }
+
+    /// @brief Indicates if the certificate is revoked according to the index.
+    auto is_revoked(const x509 cert) const noexcept -> bool {
+        return snapshot()->is_revoked(cert);
+    }
+
+    /// @brief Indexes the specified CRLs issued by certificates in the store.
+    /// @return The number of issuers with new or replaced revocations.
+    auto update(
+      const std::span<const x509_crl> crls,
+      const x509_store trusted) -> span_size_t {
+        const std::unique_lock lock{_update_mutex};
+        auto next{std::make_shared<revocation_snapshot>(*snapshot())};
+        const auto now{std::chrono::system_clock::now()};
+        span_size_t replaced{0};
+        for(const auto crl : crls) {
+            const auto issuer{as_std_view(get_x509_crl_issuer_der(crl))};
+            if(issuer.empty()) {
+                continue;
+            }
+            const auto last_update{get_x509_crl_last_update(crl)};
+            const auto next_update{get_x509_crl_next_update(crl)};
+            if(
+              (last_update > now + _max_clock_skew) or
+              (next_update and (*next_update + _max_clock_skew < now))) {
+                continue;
+            }
+            auto pos{next->_issuers.find(issuer)};
+            if(
+              (pos != next->_issuers.end()) and
+              (pos->second->last_update() >= last_update)) {
+                continue;
+            }
+            if(not verify_x509_crl_signature(crl, trusted)) {
+                continue;
+            }
+            std::vector<std::string> serials;
+            collect_revoked_serials(crl, serials);
+            auto revocations{std::make_shared<const issuer_revocations>(
+              last_update, next_update, std::move(serials))};
+            if(pos != next->_issuers.end()) {
+                pos->second = std::move(revocations);
+            } else {
+                next->_issuers.emplace(std::string{issuer}, std::move(revocations));
+            }
+            ++replaced;
+        }
+        if(replaced > 0) {
+            const std::lock_guard current_lock{_current_mutex};
+            _current = std::move(next);
+        }
+        return replaced;
+    }
+
+    /// @brief Parses and indexes all CRLs from a PEM encoded block.
+    /// @param trusted the store with the certificates of the CRL issuers.
+    /// @param add_into_store indicates if the CRLs are also added into trusted.
+    /// @return The number of issuers with new or replaced revocations.
+    /// @see basic_ssl_constants::x509_v_flag_crl_check
+    auto load(
+      const memory::const_block pem,
+      const x509_store trusted,
+      const bool add_into_store = false) -> span_size_t {
+        std::vector<owned_x509_crl> owned;
+        if(ok mbio{_ssl.new_block_basic_io(pem)}) {
+            const auto del_bio{_ssl.delete_basic_io.raii(mbio)};
+
+            while(true) {
+                if(ok crl{_ssl.read_bio_x509_crl(mbio)}) {
+                    owned.push_back(std::move(crl.get()));
+                } else {
+                    break;
+                }
+            }
+        }
+
+        std::vector<x509_crl> crls;
+        crls.reserve(owned.size());
+        for(const auto& crl : owned) {
+            crls.emplace_back(crl);
+        }
+        const auto replaced{update(crls, trusted)};
+        if(add_into_store) {
+            for(const auto crl : crls) {
+                if(verify_x509_crl_signature(crl, trusted)) {
+                    _ssl.add_crl_into_x509_store(trusted, crl);
+                }
+            }
+        }
+        for(auto& crl : owned) {
+            _ssl.delete_x509_crl(std::move(crl));
+        }
+        return replaced;
+    }
+
+private:
+    const basic_ssl_api<ApiTraits>& _ssl;
+    const std::chrono::seconds _max_clock_skew;
+    std::mutex _update_mutex;
+    // guards only the swap, std::atomic<std::shared_ptr> is not portable
+    mutable std::mutex _current_mutex;
+    std::shared_ptr<const revocation_snapshot> _current;
+};
+//------------------------------------------------------------------------------
+export using crl_index = basic_crl_index<ssl_api_traits>;
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
@@ -0,0 +1,154 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+module;
+
+#if __has_include(<openssl/x509.h>)
+#include <openssl/asn1.h>
+#include <openssl/x509.h>
+#include <openssl/x509v3.h>
+
+#define EAGINE_HAS_SSL 1
+#else
+#define EAGINE_HAS_SSL 0
+#endif
+
+module eagine.sslplus;
+
+import std;
+import eagine.core.memory;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+#if EAGINE_HAS_SSL
+static auto name_der(const X509_NAME* name) noexcept -> memory::const_block {
+    const unsigned char* der{nullptr};
+    std::size_t size{0U};
+    if(name and X509_NAME_get0_der(name, &der, &size)) {
+        return {der, span_size(size)};
+    }
+    return {};
+}
+
+static auto integer_bytes(const ASN1_INTEGER* value) noexcept
+  -> memory::const_block {
+    if(value) {
+        return {
+          ASN1_STRING_get0_data(value), span_size(ASN1_STRING_length(value))};
+    }
+    return {};
+}
+#endif
+//------------------------------------------------------------------------------
+auto get_x509_issuer_der([[maybe_unused]] const x509 cert) noexcept
+  -> memory::const_block {
+#if EAGINE_HAS_SSL
+    if(cert) {
+        return name_der(X509_get_issuer_name(static_cast<X509*>(cert)));
+    }
+#endif
+    return {};
+}
+//------------------------------------------------------------------------------
+auto get_x509_serial_bytes([[maybe_unused]] const x509 cert) noexcept
+  -> memory::const_block {
+#if EAGINE_HAS_SSL
+    if(cert) {
+        return integer_bytes(X509_get0_serialNumber(static_cast<X509*>(cert)));
+    }
+#endif
+    return {};
+}
+//------------------------------------------------------------------------------
+auto get_x509_crl_issuer_der([[maybe_unused]] const x509_crl crl) noexcept
+  -> memory::const_block {
+#if EAGINE_HAS_SSL
+    if(crl) {
+        return name_der(X509_CRL_get_issuer(static_cast<X509_CRL*>(crl)));
+    }
+#endif
+    return {};
+}
+//------------------------------------------------------------------------------
+auto get_x509_crl_last_update([[maybe_unused]] const x509_crl crl) noexcept
+  -> std::chrono::system_clock::time_point {
+#if EAGINE_HAS_SSL
+    if(crl) {
+        const auto* native{static_cast<X509_CRL*>(crl)};
+        return as_time_point(asn1_string{X509_CRL_get0_lastUpdate(native)})
+          .value_or(std::chrono::system_clock::time_point{});
+    }
+#endif
+    return {};
+}
+//------------------------------------------------------------------------------
+auto get_x509_crl_next_update([[maybe_unused]] const x509_crl crl) noexcept
+  -> std::optional<std::chrono::system_clock::time_point> {
+#if EAGINE_HAS_SSL
+    if(crl) {
+        return as_time_point(asn1_string{
+          X509_CRL_get0_nextUpdate(static_cast<X509_CRL*>(crl))});
+    }
+#endif
+    return {};
+}
+//------------------------------------------------------------------------------
+auto verify_x509_crl_signature(
+  [[maybe_unused]] const x509_crl crl,
+  [[maybe_unused]] const x509_store trusted) noexcept -> bool {
+#if EAGINE_HAS_SSL
+    if(not crl or not trusted) {
+        return false;
+    }
+    auto* raw_crl{static_cast<X509_CRL*>(crl)};
+    X509_STORE_CTX* ctx{X509_STORE_CTX_new()};
+    if(not ctx) {
+        return false;
+    }
+    bool verified{false};
+    if(X509_STORE_CTX_init(
+         ctx, static_cast<X509_STORE*>(trusted), nullptr, nullptr)) {
+        if(auto* issuers{X509_STORE_CTX_get1_certs(
+             ctx, X509_CRL_get_issuer(raw_crl))}) {
+            const auto count{sk_X509_num(issuers)};
+            for(int i = 0; not verified and (i < count); ++i) {
+                auto* issuer{sk_X509_value(issuers, i)};
+                verified =
+                  ((X509_get_key_usage(issuer) & KU_CRL_SIGN) != 0U) and
+                  (X509_CRL_verify(raw_crl, X509_get0_pubkey(issuer)) > 0);
+            }
+            sk_X509_pop_free(issuers, X509_free);
+        }
+    }
+    X509_STORE_CTX_free(ctx);
+    return verified;
+#else
+    return false;
+#endif
+}
+//------------------------------------------------------------------------------
+void collect_revoked_serials(
+  [[maybe_unused]] const x509_crl crl,
+  [[maybe_unused]] std::vector<std::string>& serials) {
+#if EAGINE_HAS_SSL
+    if(crl) {
+        if(auto* revoked{X509_CRL_get_REVOKED(static_cast<X509_CRL*>(crl))}) {
+            const auto count{sk_X509_REVOKED_num(revoked)};
+            serials.reserve(serials.size() + std_size(count));
+            for(int i = 0; i < count; ++i) {
+                const auto serial{integer_bytes(X509_REVOKED_get0_serialNumber(
+                  sk_X509_REVOKED_value(revoked, i)))};
+                serials.emplace_back(
+                  reinterpret_cast<const char*>(serial.data()),
+                  std_size(serial.size()));
+            }
+        }
+    }
+#endif
+}
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
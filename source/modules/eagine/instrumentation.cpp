@@ -0,0 +1,291 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+export module eagine.sslplus:instrumentation;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+import eagine.core.identifier;
+import eagine.core.main_ctx;
+import :api_traits;
+import :api;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+/// @brief Call statistics of a single bound OpenSSL function.
+/// @see ssl_call_registry
+export class ssl_function_stats {
+public:
+    static constexpr const std::size_t histogram_size{48U};
+
+    ssl_function_stats(
+      const string_view name,
+      const bool heavy,
+      const bool checked) noexcept
+      : _name{name}
+      , _heavy{heavy}
+      , _checked{checked} {}
+
+    /// @brief The name of the OpenSSL function.
+    auto name() const noexcept -> string_view {
+        return _name;
+    }
+
+    /// @brief Indicates if a latency histogram is recorded for the function.
+    auto is_heavy() const noexcept -> bool {
+        return _heavy;
+    }
+
+    /// @brief Indicates if the function has a known failure convention.
+    /// @see failures
+    auto counts_failures() const noexcept -> bool {
+        return _checked;
+    }
+
+    /// @brief Records a single call with the specified duration.
+    void record(
+      const std::chrono::nanoseconds elapsed,
+      const bool failed) noexcept {
+        const auto ns{static_cast<std::uint64_t>(elapsed.count())};
+        _calls.fetch_add(1U, std::memory_order_relaxed);
+        _nanoseconds.fetch_add(ns, std::memory_order_relaxed);
+        if(failed) {
+            _failures.fetch_add(1U, std::memory_order_relaxed);
+        }
+        if(_heavy) {
+            const auto bucket{std::min<std::size_t>(
+              std::bit_width(ns), histogram_size - 1U)};
+            _histogram[bucket].fetch_add(1U, std::memory_order_relaxed);
+        }
+    }
+
+    auto calls() const noexcept -> std::uint64_t {
+        return _calls.load(std::memory_order_relaxed);
+    }
+
+    /// @brief The number of failed calls, zero if failures are not counted.
+    auto failures() const noexcept -> std::uint64_t {
+        return _failures.load(std::memory_order_relaxed);
+    }
+
+    auto total_time() const noexcept -> std::chrono::nanoseconds {
+        return std::chrono::nanoseconds{
+          _nanoseconds.load(std::memory_order_relaxed)};
+    }
+
+    /// @brief Returns the count of calls with latency in [2^(i-1), 2^i) ns.
+    auto histogram_bucket(const std::size_t i) const noexcept -> std::uint64_t {
+        return _histogram[i].load(std::memory_order_relaxed);
+    }
+
+    /// @brief Returns the latency bound of the specified fraction of calls.
+    auto latency_quantile(const float q) const noexcept
+      -> std::chrono::nanoseconds {
+        std::uint64_t total{0U};
+        for(std::size_t i = 0; i < histogram_size; ++i) {
+            total += histogram_bucket(i);
+        }
+        const auto limit{static_cast<std::uint64_t>(float(total) * q)};
+        std::uint64_t count{0U};
+        for(std::size_t i = 0; i < histogram_size; ++i) {
+            count += histogram_bucket(i);
+            if(count > limit) {
+                return std::chrono::nanoseconds{std::uint64_t(1U) << i};
+            }
+        }
+        return {};
+    }
+
+private:
+    const string_view _name;
+    const bool _heavy;
+    const bool _checked;
+    std::atomic<std::uint64_t> _calls{0U};
+    std::atomic<std::uint64_t> _failures{0U};
+    std::atomic<std::uint64_t> _nanoseconds{0U};
+    std::array<std::atomic<std::uint64_t>, histogram_size> _histogram{};
+};
+//------------------------------------------------------------------------------
+/// @brief Process-wide registry of call statistics of bound OpenSSL functions.
+/// @see instrumented_ssl_api_traits
+export class ssl_call_registry {
+public:
+    using any_function_ptr = void (*)();
+
+    /// @brief Registers a linked function, returns its statistics.
+    auto add(const any_function_ptr function, const string_view name)
+      -> ssl_function_stats&;
+
+    /// @brief Returns the statistics of a registered function or nullptr.
+    /// @note Does not lock, this is called on each instrumented call.
+    auto find(const any_function_ptr function) const noexcept
+      -> ssl_function_stats* {
+        auto index{_slot_of(function)};
+        for(std::size_t probe = 0; probe < _table_size; ++probe) {
+            const auto& slot{_table[index]};
+            const auto linked{slot.function.load(std::memory_order_acquire)};
+            if(linked == function) {
+                return slot.stats.load(std::memory_order_acquire);
+            }
+            if(linked == nullptr) {
+                break;
+            }
+            index = (index + 1U) & (_table_size - 1U);
+        }
+        return nullptr;
+    }
+
+    /// @brief Calls func with the statistics of each registered function.
+    template <typename Function>
+    void for_each(const Function& func) const {
+        const std::shared_lock lock{_mutex};
+        for(const auto& stats : _stats) {
+            func(stats);
+        }
+    }
+
+private:
+    // the functions are registered when linked and never removed, so the
+    // lookups can use an insert-only open addressing table without locks
+    static constexpr const std::size_t _table_size{1024U};
+
+    struct _slot {
+        std::atomic<any_function_ptr> function{nullptr};
+        std::atomic<ssl_function_stats*> stats{nullptr};
+    };
+
+    static auto _slot_of(const any_function_ptr function) noexcept
+      -> std::size_t {
+        const auto bits{reinterpret_cast<std::uintptr_t>(function)};
+        return std::size_t((bits >> 4U) ^ (bits >> 14U)) & (_table_size - 1U);
+    }
+
+    mutable std::shared_mutex _mutex;
+    std::deque<ssl_function_stats> _stats;
+    std::array<_slot, _table_size> _table{};
+};
+
+/// @brief Returns a reference to the process-wide call statistics registry.
+export auto ssl_call_statistics() noexcept -> ssl_call_registry&;
+//------------------------------------------------------------------------------
+/// @brief API traits counting calls, failures and time of OpenSSL functions.
+/// @see ssl_api_traits
+/// @see log_call_statistics
+///
+/// Use basic_ssl_api<instrumented_ssl_api_traits> instead of ssl_api to
+/// enable the instrumentation. With the default ssl_api_traits none of this
+/// is instantiated. Failures are counted only for the functions returning
+/// one on success, or a new object on success, which are listed in the
+/// implementation. There int results lower than one and null pointers are
+/// the failures. Other results, like those of X509_STORE_CTX_get_error,
+/// X509_check_issued or X509_cmp, are not interpreted. Latency histograms
+/// with log2 buckets are recorded for the signing, verification, derivation
+/// and key generation functions.
+export class instrumented_ssl_api_traits : public ssl_api_traits {
+public:
+    template <typename Api, typename Tag, typename Signature>
+    auto link_function(
+      Api& api,
+      const Tag tag,
+      const string_view name,
+      const std::type_identity<Signature> sig)
+      -> std::add_pointer_t<Signature> {
+        const auto function{ssl_api_traits::link_function(api, tag, name, sig)};
+        if(function) {
+            ssl_call_statistics().add(
+              reinterpret_cast<ssl_call_registry::any_function_ptr>(function),
+              name);
+        }
+        return function;
+    }
+
+    template <typename Tag, typename RV, typename... Params, typename... Args>
+    static auto call_static(
+      const Tag,
+      RV (*function)(Params...),
+      Args&&... args) noexcept -> RV {
+        return _call(function, std::forward<Args>(args)...);
+    }
+
+    template <typename Tag, typename RV, typename... Params, typename... Args>
+    static auto call_dynamic(
+      const Tag,
+      RV (*function)(Params...),
+      Args&&... args) noexcept -> RV {
+        return _call(function, std::forward<Args>(args)...);
+    }
+
+private:
+    template <typename RV>
+    static auto _failed(const RV& result) noexcept -> bool {
+        if constexpr(std::is_pointer_v<RV>) {
+            return result == nullptr;
+        } else if constexpr(std::is_same_v<RV, int>) {
+            return result < 1;
+        } else {
+            return false;
+        }
+    }
+
+    template <typename RV, typename... Params, typename... Args>
+    static auto _call(RV (*function)(Params...), Args&&... args) noexcept
+      -> RV {
+        using clock = std::chrono::steady_clock;
+        auto* stats{ssl_call_statistics().find(
+          reinterpret_cast<ssl_call_registry::any_function_ptr>(function))};
+        if(not stats) {
+            return function(std::forward<Args>(args)...);
+        }
+        const auto start{clock::now()};
+        if constexpr(std::is_void_v<RV>) {
+            function(std::forward<Args>(args)...);
+            stats->record(clock::now() - start, false);
+        } else {
+            RV result = function(std::forward<Args>(args)...);
+            stats->record(
+              clock::now() - start,
+              stats->counts_failures() and _failed(result));
+            return result;
+        }
+    }
+};
+//------------------------------------------------------------------------------
+/// @brief Logs the collected call statistics of the bound OpenSSL functions.
+/// @see instrumented_ssl_api_traits
+export template <typename ApiTraits>
+void log_call_statistics(const basic_ssl_api<ApiTraits>& ssl) {
+    ssl_call_statistics().for_each([&](const ssl_function_stats& stats) {
+        if(stats.calls() == 0U) {
+            return;
+        }
+        if(stats.is_heavy()) {
+            ssl
+              .log_stat(
+                "${function}: ${calls} calls, ${failures} failures, "
+                "total ${totalTime}, p50 ${p50}, p90 ${p90}, p99 ${p99}")
+              .arg(identifier{"function"}, stats.name())
+              .arg(identifier{"calls"}, stats.calls())
+              .arg(identifier{"failures"}, stats.failures())
+              .arg(identifier{"totalTime"}, stats.total_time())
+              .arg(identifier{"p50"}, stats.latency_quantile(0.50F))
+              .arg(identifier{"p90"}, stats.latency_quantile(0.90F))
+              .arg(identifier{"p99"}, stats.latency_quantile(0.99F));
+        } else {
+            ssl
+              .log_stat(
+                "${function}: ${calls} calls, ${failures} failures, "
+                "total ${totalTime}")
+              .arg(identifier{"function"}, stats.name())
+              .arg(identifier{"calls"}, stats.calls())
+              .arg(identifier{"failures"}, stats.failures())
+              .arg(identifier{"totalTime"}, stats.total_time());
+        }
+    });
+}
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
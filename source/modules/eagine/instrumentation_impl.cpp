@@ -0,0 +1,173 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+module eagine.sslplus;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+static auto is_heavy_ssl_function(const string_view name) noexcept -> bool {
+    static constexpr const std::array<string_view, 8> heavy{
+      {"EVP_DigestSign",
+       "EVP_DigestSignFinal",
+       "EVP_DigestVerify",
+       "EVP_DigestVerifyFinal",
+       "EVP_PKEY_derive",
+       "EVP_PKEY_keygen",
+       "EVP_KDF_derive",
+       "X509_verify_cert"}};
+    return std::find(heavy.begin(), heavy.end(), name) != heavy.end();
+}
+//------------------------------------------------------------------------------
+// the functions returning one on success or a new object on success
+static auto is_checked_ssl_function(const string_view name) noexcept -> bool {
+    static constexpr const std::array<string_view, 108> checked{
+      {// status results
+       "ASN1_INTEGER_get_int64",
+       "ASN1_INTEGER_get_uint64",
+       "BIO_free",
+       "BIO_up_ref",
+       "CRYPTO_secure_malloc_done",
+       "CRYPTO_secure_malloc_init",
+       "EVP_CIPHER_CTX_reset",
+       "EVP_CipherFinal_ex",
+       "EVP_CipherInit",
+       "EVP_CipherInit_ex",
+       "EVP_CipherUpdate",
+       "EVP_DecryptFinal_ex",
+       "EVP_DecryptInit",
+       "EVP_DecryptInit_ex",
+       "EVP_DecryptUpdate",
+       "EVP_DigestFinal_ex",
+       "EVP_DigestInit",
+       "EVP_DigestInit_ex",
+       "EVP_DigestSign",
+       "EVP_DigestSignFinal",
+       "EVP_DigestSignInit",
+       "EVP_DigestUpdate",
+       "EVP_DigestVerify",
+       "EVP_DigestVerifyFinal",
+       "EVP_DigestVerifyInit",
+       "EVP_EncryptFinal_ex",
+       "EVP_EncryptInit",
+       "EVP_EncryptInit_ex",
+       "EVP_EncryptUpdate",
+       "EVP_KDF_derive",
+       "EVP_MD_CTX_copy_ex",
+       "EVP_MD_CTX_reset",
+       "EVP_PKEY_CTX_set_group_name",
+       "EVP_PKEY_CTX_set_rsa_keygen_bits",
+       "EVP_PKEY_derive",
+       "EVP_PKEY_derive_init",
+       "EVP_PKEY_derive_set_peer",
+       "EVP_PKEY_get_size",
+       "EVP_PKEY_keygen",
+       "EVP_PKEY_keygen_init",
+       "EVP_PKEY_up_ref",
+       "OCSP_basic_verify",
+       "OCSP_request_add1_nonce",
+       "OSSL_LIB_CTX_load_config",
+       "OSSL_PARAM_BLD_push_octet_string",
+       "OSSL_PARAM_BLD_push_uint32",
+       "OSSL_PARAM_BLD_push_uint64",
+       "OSSL_PARAM_BLD_push_utf8_string",
+       "OSSL_PARAM_get_octet_string_ptr",
+       "OSSL_PROVIDER_self_test",
+       "OSSL_PROVIDER_set_default_search_path",
+       "OSSL_PROVIDER_unload",
+       "OSSL_set_max_threads",
+       "PEM_write_bio_PKCS8PrivateKey",
+       "RAND_bytes",
+       "RAND_bytes_ex",
+       "RAND_priv_bytes",
+       "RAND_priv_bytes_ex",
+       "X509_LOOKUP_ctrl",
+       "X509_STORE_CTX_init",
+       "X509_STORE_CTX_set_ex_data",
+       "X509_STORE_CTX_set_purpose",
+       "X509_STORE_add_cert",
+       "X509_STORE_add_crl",
+       "X509_STORE_load_locations",
+       "X509_STORE_lock",
+       "X509_STORE_set_flags",
+       "X509_STORE_unlock",
+       "X509_STORE_up_ref",
+       "X509_digest",
+       "X509_pubkey_digest",
+       "X509_verify_cert",
+       "i2d_PKCS8PrivateKey_bio",
+       // object results
+       "BIO_new",
+       "BIO_new_mem_buf",
+       "EVP_CIPHER_CTX_new",
+       "EVP_CIPHER_fetch",
+       "EVP_KDF_CTX_new",
+       "EVP_KDF_fetch",
+       "EVP_MAC_fetch",
+       "EVP_MD_CTX_new",
+       "EVP_MD_fetch",
+       "EVP_PKEY_CTX_new",
+       "EVP_PKEY_CTX_new_from_name",
+       "EVP_PKEY_new",
+       "OCSP_CERTID_dup",
+       "OCSP_REQUEST_new",
+       "OCSP_cert_to_id",
+       "OCSP_request_add0_id",
+       "OCSP_response_get1_basic",
+       "OSSL_LIB_CTX_new",
+       "OSSL_LIB_CTX_new_child",
+       "OSSL_LIB_CTX_new_from_dispatch",
+       "OSSL_PARAM_BLD_new",
+       "OSSL_PARAM_BLD_to_param",
+       "OSSL_PROVIDER_load",
+       "OSSL_PROVIDER_try_load",
+       "PEM_read_bio_PUBKEY",
+       "PEM_read_bio_PrivateKey",
+       "PEM_read_bio_X509",
+       "PEM_read_bio_X509_CRL",
+       "X509_CRL_new",
+       "X509_STORE_CTX_new",
+       "X509_STORE_add_lookup",
+       "X509_STORE_new",
+       "X509_get_pubkey",
+       "X509_new",
+       "d2i_X509_bio"}};
+    return std::find(checked.begin(), checked.end(), name) != checked.end();
+}
+//------------------------------------------------------------------------------
+auto ssl_call_registry::add(
+  const any_function_ptr function,
+  const string_view name) -> ssl_function_stats& {
+    const std::unique_lock lock{_mutex};
+    if(auto* stats{find(function)}) {
+        return *stats;
+    }
+    auto& stats{_stats.emplace_back(
+      name, is_heavy_ssl_function(name), is_checked_ssl_function(name))};
+    auto index{_slot_of(function)};
+    for(std::size_t probe = 0; probe < _table_size; ++probe) {
+        auto& slot{_table[index]};
+        if(slot.function.load(std::memory_order_relaxed) == nullptr) {
+            // publish the statistics before the key
+            slot.stats.store(&stats, std::memory_order_release);
+            slot.function.store(function, std::memory_order_release);
+            break;
+        }
+        index = (index + 1U) & (_table_size - 1U);
+    }
+    return stats;
+}
+//------------------------------------------------------------------------------
+auto ssl_call_statistics() noexcept -> ssl_call_registry& {
+    static ssl_call_registry registry;
+    return registry;
+}
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
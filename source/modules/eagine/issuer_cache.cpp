@@ -0,0 +1,236 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+export module eagine.sslplus:issuer_cache;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+import eagine.core.utility;
+import :api_traits;
+import :object_handle;
+import :object_stack;
+import :api;
+import :verification;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+/// @brief Statistics of a basic_issuer_cache.
+export struct issuer_cache_stats {
+    /// @brief Number of issuer name lookups answered from the cache.
+    std::size_t hits{0U};
+    /// @brief Number of issuer name lookups that searched the directories.
+    std::size_t misses{0U};
+    /// @brief Number of certificates loaded from the directories.
+    std::size_t loaded{0U};
+    /// @brief Number of issuer names evicted from the cache.
+    std::size_t evictions{0U};
+    /// @brief Current number of cached issuer names.
+    std::size_t size{0U};
+};
+//------------------------------------------------------------------------------
+/// @brief Bounded cache of CA certificates loaded from hashed directories.
+/// @see basic_ssl_api::add_x509_store_hash_dir
+///
+/// The directories have the layout used by X509_LOOKUP_hash_dir, where
+/// each certificate is stored in a PEM file named `<hash>.<n>` after the hash
+/// of its subject name. Issuers are loaded only when a certificate issued
+/// by them is verified and the least recently used issuer names are evicted
+/// when the capacity is reached. Unlike the lookup attached to a store,
+/// which keeps every loaded certificate, the memory use stays bounded for
+/// trust stores with a huge number of CAs. The cache is thread-safe.
+export template <typename ApiTraits>
+class basic_issuer_cache {
+public:
+    /// @brief Construction with the searched directories and the capacity.
+    /// @param capacity The maximum number of cached issuer names.
+    basic_issuer_cache(
+      const basic_ssl_api<ApiTraits>& ssl,
+      std::vector<std::filesystem::path> directories,
+      const span_size_t capacity = 256)
+      : _ssl{ssl}
+      , _directories{std::move(directories)}
+      , _capacity{std::max(std_size(capacity), std::size_t(1U))} {}
+
+    /// @brief Appends the certificates that issued cert to the issuers stack.
+    /// @return The number of appended certificates.
+    ///
+    /// The references in the stack remain valid after the issuers are
+    /// evicted from the cache.
+    auto find_issuers(const x509 cert, object_stack<owned_x509>& issuers)
+      -> span_size_t {
+        const auto name_hash{_ssl.get_x509_issuer_name_hash(cert).value_or(0UL)};
+        if(name_hash == 0UL) {
+            return 0;
+        }
+        std::unique_lock lock{_mutex};
+        auto pos{_entries.find(name_hash)};
+        if(pos == _entries.end()) {
+            ++_stats.misses;
+            // don't block other lookups while reading the files
+            lock.unlock();
+            auto certs{_load(name_hash)};
+            const auto loaded{std_size(certs.size())};
+            lock.lock();
+            _stats.loaded += loaded;
+            pos = _entries.find(name_hash);
+            if(pos == _entries.end()) {
+                pos = _insert(name_hash, std::move(certs));
+            }
+        } else {
+            ++_stats.hits;
+            _lru.splice(_lru.begin(), _lru, pos->second.lru);
+        }
+
+        span_size_t count{0};
+        for(const x509 candidate : pos->second.certs) {
+            if(_ssl.check_x509_issued(candidate, cert).value_or(-1) == 0) {
+                issuers.push_ref(candidate);
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    /// @brief Collects the cached trust anchors for the leaf certificate.
+    /// @return Indicates if a self-issued root was found for the chain.
+    ///
+    /// Follows the chain from the leaf through the cached issuers or the
+    /// untrusted intermediates and appends all issuers found in the cache
+    /// to the trusted stack, which can then be used for verification.
+    auto collect_trusted(
+      const x509 leaf,
+      const object_stack<x509>& intermediates,
+      object_stack<owned_x509>& trusted,
+      const int max_depth = 16) -> bool {
+        x509 current{leaf};
+        for(int depth = 0; current and (depth < max_depth); ++depth) {
+            const auto first{trusted.size()};
+            x509 next{};
+            if(find_issuers(current, trusted) > 0) {
+                next = trusted.get(first);
+                if(_is_self_issued(next)) {
+                    return true;
+                }
+            } else {
+                for(const x509 candidate : intermediates) {
+                    if(_issued(candidate, current)) {
+                        next = candidate;
+                        break;
+                    }
+                }
+            }
+            current = next;
+        }
+        return false;
+    }
+
+    /// @brief Verifies the leaf certificate against issuers from this cache.
+    /// @see basic_chain_verifier
+    ///
+    /// The certificates in the store are not used as trust anchors, but the
+    /// store still supplies the CRLs and the verification parameters.
+    auto verify_chain(
+      basic_chain_verifier<ApiTraits>& verifier,
+      const x509_store store,
+      const x509 leaf,
+      const object_stack<x509>& intermediates,
+      const chain_verification_options& opts = {})
+      -> chain_verification_result {
+        object_stack<owned_x509> trusted;
+        collect_trusted(leaf, intermediates, trusted);
+        return verifier.verify_chain(store, leaf, intermediates, trusted, opts);
+    }
+
+    /// @brief Returns the current statistics.
+    auto stats() const noexcept -> issuer_cache_stats {
+        const std::lock_guard lock{_mutex};
+        auto result{_stats};
+        result.size = _entries.size();
+        return result;
+    }
+
+    /// @brief Returns the number of cached issuer names.
+    auto size() const noexcept -> span_size_t {
+        const std::lock_guard lock{_mutex};
+        return span_size(_entries.size());
+    }
+
+    /// @brief Removes all cached issuers, for example after the directories
+    /// were updated.
+    void clear() noexcept {
+        const std::lock_guard lock{_mutex};
+        _entries.clear();
+        _lru.clear();
+    }
+
+private:
+    struct entry {
+        // empty if no certificate with the name exists, to avoid re-reading
+        object_stack<owned_x509> certs;
+        std::list<unsigned long>::iterator lru;
+    };
+
+    auto _issued(const x509 issuer, const x509 cert) const noexcept -> bool {
+        return _ssl.check_x509_issued(issuer, cert).value_or(-1) == 0;
+    }
+
+    auto _is_self_issued(const x509 cert) const noexcept -> bool {
+        return _issued(cert, cert);
+    }
+
+    auto _load(const unsigned long name_hash) const
+      -> object_stack<owned_x509> {
+        object_stack<owned_x509> certs;
+        for(const auto& dir : _directories) {
+            for(int seq = 0;; ++seq) {
+                std::ifstream file{
+                  dir / std::format("{:08x}.{}", name_hash, seq),
+                  std::ios::in | std::ios::binary};
+                if(not file.is_open()) {
+                    break;
+                }
+                const std::string pem{
+                  std::istreambuf_iterator<char>{file},
+                  std::istreambuf_iterator<char>{}};
+                if(ok cert{_ssl.parse_x509(
+                     memory::const_block{
+                       reinterpret_cast<const byte*>(pem.data()),
+                       span_size(pem.size())},
+                     {})}) {
+                    certs.push(std::move(cert.get()));
+                }
+            }
+        }
+        return certs;
+    }
+
+    auto _insert(const unsigned long name_hash, object_stack<owned_x509> certs)
+      -> typename std::unordered_map<unsigned long, entry>::iterator {
+        if(_entries.size() >= _capacity) {
+            _entries.erase(_lru.back());
+            _lru.pop_back();
+            ++_stats.evictions;
+        }
+        _lru.push_front(name_hash);
+        return _entries
+          .try_emplace(name_hash, entry{std::move(certs), _lru.begin()})
+          .first;
+    }
+
+    const basic_ssl_api<ApiTraits>& _ssl;
+    const std::vector<std::filesystem::path> _directories;
+    const std::size_t _capacity;
+    mutable std::mutex _mutex;
+    std::unordered_map<unsigned long, entry> _entries;
+    std::list<unsigned long> _lru;
+    issuer_cache_stats _stats{};
+};
+//------------------------------------------------------------------------------
+export using issuer_cache = basic_issuer_cache<ssl_api_traits>;
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
@@ -0,0 +1,299 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+export module eagine.sslplus:kdf;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+import eagine.core.utility;
+import eagine.core.c_api;
+import :api_traits;
+import :object_handle;
+import :api;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+/// @brief Parameters of the HKDF key derivation.
+/// @see basic_hkdf
+export struct hkdf_params {
+    string_view digest{"SHA256"};
+    memory::const_block key{};
+    memory::const_block salt{};
+    memory::const_block info{};
+};
+
+/// @brief Parameters of the PBKDF2 key derivation.
+/// @see basic_pbkdf2
+export struct pbkdf2_params {
+    string_view digest{"SHA256"};
+    memory::const_block password{};
+    memory::const_block salt{};
+    std::uint64_t iterations{600000U};
+    /// @brief Enforce the SP800-132 minimums of iterations, salt and key size.
+    bool sp800_132_checks{true};
+};
+
+/// @brief Parameters of the scrypt key derivation.
+/// @see basic_scrypt
+export struct scrypt_params {
+    memory::const_block password{};
+    memory::const_block salt{};
+    /// @brief The CPU/memory cost, must be a power of two.
+    std::uint64_t cost{std::uint64_t(1U) << 15U};
+    std::uint32_t block_size{8U};
+    std::uint32_t parallelism{1U};
+    /// @brief The maximum memory usage in bytes, zero means OpenSSL default.
+    std::uint64_t max_memory{0U};
+};
+
+/// @brief Parameters of the Argon2 key derivation.
+/// @see basic_argon2
+export struct argon2_params {
+    memory::const_block password{};
+    memory::const_block salt{};
+    memory::const_block secret{};
+    memory::const_block additional{};
+    std::uint32_t iterations{3U};
+    /// @brief The number of memory lanes (degree of parallelism).
+    std::uint32_t lanes{4U};
+    /// @brief The number of threads computing the lanes.
+    std::uint32_t threads{1U};
+    /// @brief The memory cost in KiB.
+    std::uint32_t memory_cost{65536U};
+};
+//------------------------------------------------------------------------------
+/// @brief Base for key derivation functions with a reused fetched EVP_KDF.
+///
+/// The algorithm and the derivation context are fetched and created once
+/// and the context is reset after each derivation. The copies of secret
+/// parameters are wiped after use. Instances are not thread-safe.
+export template <typename ApiTraits>
+class basic_key_derivation {
+public:
+    basic_key_derivation(
+      const basic_ssl_api<ApiTraits>& ssl,
+      const string_view algorithm,
+      const lib_ctx libctx = {}) noexcept
+      : _ssl{ssl}
+      , _libctx{libctx} {
+        if(ok fetched{_ssl.fetch_kdf(libctx, algorithm, string_view{})}) {
+            if(ok ctx{_ssl.new_kdf_ctx(fetched)}) {
+                _kdf = std::move(fetched.get());
+                _ctx = std::move(ctx.get());
+                return;
+            }
+            _ssl.delete_kdf(std::move(fetched.get()));
+        }
+    }
+
+    basic_key_derivation(basic_key_derivation&&) noexcept = default;
+    basic_key_derivation(const basic_key_derivation&) = delete;
+    auto operator=(basic_key_derivation&&) = delete;
+    auto operator=(const basic_key_derivation&) = delete;
+
+    ~basic_key_derivation() noexcept {
+        if(_ctx) {
+            _ssl.delete_kdf_ctx(std::move(_ctx));
+        }
+        if(_kdf) {
+            _ssl.delete_kdf(std::move(_kdf));
+        }
+    }
+
+    /// @brief Indicates if the algorithm was fetched successfully.
+    explicit operator bool() const noexcept {
+        return _kdf and _ctx;
+    }
+
+protected:
+    auto ssl() const noexcept -> const basic_ssl_api<ApiTraits>& {
+        return _ssl;
+    }
+
+    auto library_context() const noexcept -> lib_ctx {
+        return _libctx;
+    }
+
+    template <typename PushParams>
+    auto derive_with(
+      memory::block dst,
+      const PushParams& push_params,
+      const std::span<const string_view> secrets) noexcept -> memory::block {
+        if(*this) {
+            if(ok bld{_ssl.new_param_builder()}) {
+                const auto del_bld{_ssl.delete_param_builder.raii(bld)};
+
+                if(push_params(bld)) {
+                    if(ok params{_ssl.build_param_list(bld)}) {
+                        const auto del_params{
+                          _ssl.delete_param_list.raii(params)};
+
+                        const auto derived{
+                          bool(_ssl.kdf_derive(_ctx, dst, params))};
+                        for(const auto key : secrets) {
+                            _ssl.cleanse_param_octets(params, key);
+                        }
+                        _ssl.kdf_ctx_reset(_ctx);
+                        if(derived) {
+                            return dst;
+                        }
+                    }
+                }
+            }
+        }
+        return {};
+    }
+
+private:
+    const basic_ssl_api<ApiTraits>& _ssl;
+    lib_ctx _libctx{};
+    owned_kdf _kdf{};
+    owned_kdf_ctx _ctx{};
+};
+//------------------------------------------------------------------------------
+/// @brief HKDF (RFC 5869) key derivation.
+export template <typename ApiTraits>
+class basic_hkdf : public basic_key_derivation<ApiTraits> {
+public:
+    basic_hkdf(
+      const basic_ssl_api<ApiTraits>& ssl,
+      const lib_ctx libctx = {}) noexcept
+      : basic_key_derivation<ApiTraits>{ssl, "HKDF", libctx} {}
+
+    /// @brief Derives a key filling the whole dst block.
+    auto derive(const hkdf_params& params, memory::block dst) noexcept
+      -> memory::block {
+        static constexpr const std::array<string_view, 1> secrets{{"key"}};
+        return this->derive_with(
+          dst,
+          [&](const param_builder bld) {
+              const auto& ssl{this->ssl()};
+              return ssl.push_string_param(bld, "digest", params.digest) and
+                     ssl.push_octets_param(bld, "key", params.key) and
+                     (params.salt.empty() or
+                      ssl.push_octets_param(bld, "salt", params.salt)) and
+                     (params.info.empty() or
+                      ssl.push_octets_param(bld, "info", params.info));
+          },
+          secrets);
+    }
+};
+//------------------------------------------------------------------------------
+/// @brief PBKDF2 (RFC 8018) password-based key derivation.
+export template <typename ApiTraits>
+class basic_pbkdf2 : public basic_key_derivation<ApiTraits> {
+public:
+    basic_pbkdf2(
+      const basic_ssl_api<ApiTraits>& ssl,
+      const lib_ctx libctx = {}) noexcept
+      : basic_key_derivation<ApiTraits>{ssl, "PBKDF2", libctx} {}
+
+    /// @brief Derives a key filling the whole dst block.
+    auto derive(const pbkdf2_params& params, memory::block dst) noexcept
+      -> memory::block {
+        static constexpr const std::array<string_view, 1> secrets{{"pass"}};
+        return this->derive_with(
+          dst,
+          [&](const param_builder bld) {
+              const auto& ssl{this->ssl()};
+              return ssl.push_string_param(bld, "digest", params.digest) and
+                     ssl.push_octets_param(bld, "pass", params.password) and
+                     ssl.push_octets_param(bld, "salt", params.salt) and
+                     ssl.push_uint64_param(bld, "iter", params.iterations) and
+                     ssl.push_uint32_param(
+                       bld, "pkcs5", params.sp800_132_checks ? 0U : 1U);
+          },
+          secrets);
+    }
+};
+//------------------------------------------------------------------------------
+/// @brief scrypt (RFC 7914) password-based key derivation.
+export template <typename ApiTraits>
+class basic_scrypt : public basic_key_derivation<ApiTraits> {
+public:
+    basic_scrypt(
+      const basic_ssl_api<ApiTraits>& ssl,
+      const lib_ctx libctx = {}) noexcept
+      : basic_key_derivation<ApiTraits>{ssl, "SCRYPT", libctx} {}
+
+    /// @brief Derives a key filling the whole dst block.
+    auto derive(const scrypt_params& params, memory::block dst) noexcept
+      -> memory::block {
+        static constexpr const std::array<string_view, 1> secrets{{"pass"}};
+        return this->derive_with(
+          dst,
+          [&](const param_builder bld) {
+              const auto& ssl{this->ssl()};
+              return ssl.push_octets_param(bld, "pass", params.password) and
+                     ssl.push_octets_param(bld, "salt", params.salt) and
+                     ssl.push_uint64_param(bld, "n", params.cost) and
+                     ssl.push_uint32_param(bld, "r", params.block_size) and
+                     ssl.push_uint32_param(bld, "p", params.parallelism) and
+                     ((params.max_memory == 0U) or
+                      ssl.push_uint64_param(
+                        bld, "maxmem_bytes", params.max_memory));
+          },
+          secrets);
+    }
+};
+//------------------------------------------------------------------------------
+/// @brief Argon2 (RFC 9106) password-based key derivation.
+/// @note Requires OpenSSL 3.2 or newer.
+export template <typename ApiTraits>
+class basic_argon2 : public basic_key_derivation<ApiTraits> {
+public:
+    /// @brief Construction with the variant name (ARGON2I, ARGON2D, ARGON2ID).
+    basic_argon2(
+      const basic_ssl_api<ApiTraits>& ssl,
+      const string_view variant = "ARGON2ID",
+      const lib_ctx libctx = {}) noexcept
+      : basic_key_derivation<ApiTraits>{ssl, variant, libctx} {}
+
+    /// @brief Derives a key filling the whole dst block.
+    /// @note Raises the thread limit of the library context if necessary.
+    auto derive(const argon2_params& params, memory::block dst) noexcept
+      -> memory::block {
+        if(params.threads > _max_threads) {
+            if(this->ssl().set_max_threads(
+                 this->library_context(), params.threads)) {
+                _max_threads = params.threads;
+            }
+        }
+        static constexpr const std::array<string_view, 2> secrets{
+          {"pass", "secret"}};
+        return this->derive_with(
+          dst,
+          [&](const param_builder bld) {
+              const auto& ssl{this->ssl()};
+              return ssl.push_octets_param(bld, "pass", params.password) and
+                     ssl.push_octets_param(bld, "salt", params.salt) and
+                     (params.secret.empty() or
+                      ssl.push_octets_param(bld, "secret", params.secret)) and
+                     (params.additional.empty() or
+                      ssl.push_octets_param(bld, "ad", params.additional)) and
+                     ssl.push_uint32_param(bld, "iter", params.iterations) and
+                     ssl.push_uint32_param(bld, "lanes", params.lanes) and
+                     ssl.push_uint32_param(
+                       bld,
+                       "threads",
+                       std::min(params.threads, _max_threads)) and
+                     ssl.push_uint32_param(bld, "memcost", params.memory_cost);
+          },
+          secrets);
+    }
+
+private:
+    std::uint32_t _max_threads{1U};
+};
+//------------------------------------------------------------------------------
+export using hkdf = basic_hkdf<ssl_api_traits>;
+export using pbkdf2 = basic_pbkdf2<ssl_api_traits>;
+export using scrypt = basic_scrypt<ssl_api_traits>;
+export using argon2 = basic_argon2<ssl_api_traits>;
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
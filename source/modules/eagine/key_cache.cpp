@@ -0,0 +1,206 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+export module eagine.sslplus:key_cache;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+import eagine.core.utility;
+import :api_traits;
+import :object_handle;
+import :api;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+/// @brief Statistics of a basic_key_cache.
+export struct key_cache_stats {
+    /// @brief Number of keys returned from the cache.
+    std::size_t hits{0U};
+    /// @brief Number of keys that had to be parsed and decrypted.
+    std::size_t misses{0U};
+    /// @brief Number of keys that failed to parse or decrypt.
+    std::size_t failures{0U};
+    /// @brief Number of parsed keys that could not be stored in the cache.
+    std::size_t insert_failures{0U};
+    /// @brief Number of keys evicted from the cache.
+    std::size_t evictions{0U};
+    /// @brief Current number of cached keys.
+    std::size_t size{0U};
+};
+//------------------------------------------------------------------------------
+/// @brief Cache of parsed private keys keyed by the hash of the PEM data.
+/// @see basic_ssl_api::parse_private_key
+///
+/// Encrypted keys are decrypted only once, the password callback is not
+/// invoked for cached keys. Because of this, an instance must be shared
+/// only by parties entitled to use all the cached keys. The least recently
+/// used keys are evicted when the capacity is reached or on trim(), which
+/// only releases the reference held by the cache. The cache does not wipe
+/// anything itself, the zeroization of the key material relies entirely on
+/// EVP_PKEY_free, once the last reference is released. The cache is
+/// thread-safe.
+export template <typename ApiTraits>
+class basic_key_cache {
+public:
+    /// @brief Construction with the maximum number of cached keys.
+    basic_key_cache(
+      const basic_ssl_api<ApiTraits>& ssl,
+      const span_size_t capacity = 64) noexcept
+      : _ssl{ssl}
+      , _capacity{std::max(std_size(capacity), std::size_t(1U))} {}
+
+    basic_key_cache(basic_key_cache&&) = delete;
+    basic_key_cache(const basic_key_cache&) = delete;
+    auto operator=(basic_key_cache&&) = delete;
+    auto operator=(const basic_key_cache&) = delete;
+
+    ~basic_key_cache() noexcept {
+        clear();
+    }
+
+    /// @brief Returns the private key from the PEM data, parsing it on a miss.
+    /// @note The caller takes the ownership of the returned key reference.
+    ///
+    /// If the parsed key cannot be stored because of an allocation failure,
+    /// it is returned without being cached and counted in insert_failures.
+    auto get(
+      const memory::const_block blk,
+      password_callback get_passwd = {}) noexcept -> owned_pkey {
+        content_hash hash{};
+        if(_ssl.sha256_digest(blk, cover(hash)).empty()) {
+            return {};
+        }
+        {
+            const std::lock_guard lock{_mutex};
+            if(const auto pos{_index.find(hash)}; pos != _index.end()) {
+                ++_stats.hits;
+                _lru.splice(_lru.begin(), _lru, pos->second);
+                return _copy(pos->second->key);
+            }
+            ++_stats.misses;
+        }
+        // the decryption may take long, don't block other lookups
+        if(ok parsed{_ssl.parse_private_key(blk, get_passwd)}) {
+            owned_pkey key{std::move(parsed.get())};
+            const std::lock_guard lock{_mutex};
+            if(const auto pos{_index.find(hash)}; pos != _index.end()) {
+                // parsed concurrently by another thread
+                _ssl.delete_pkey(std::move(key));
+                return _copy(pos->second->key);
+            }
+            if(_lru.size() >= _capacity) {
+                _evict_last();
+            }
+            if(not _insert(hash)) {
+                ++_stats.insert_failures;
+                return key;
+            }
+            _lru.front().key = std::move(key);
+            return _copy(_lru.front().key);
+        }
+        const std::lock_guard lock{_mutex};
+        ++_stats.failures;
+        return {};
+    }
+
+    /// @brief Evicts the least recently used keys, keeping at most count.
+    /// @return The number of evicted keys.
+    ///
+    /// Can be called when the application is under memory pressure.
+    auto trim(const span_size_t count = 0) noexcept -> span_size_t {
+        const std::lock_guard lock{_mutex};
+        span_size_t evicted{0};
+        while(_lru.size() > std_size(std::max(count, span_size_t(0)))) {
+            _evict_last();
+            ++evicted;
+        }
+        return evicted;
+    }
+
+    /// @brief Returns the current statistics.
+    auto stats() const noexcept -> key_cache_stats {
+        const std::lock_guard lock{_mutex};
+        auto result{_stats};
+        result.size = _lru.size();
+        return result;
+    }
+
+    /// @brief Returns the number of cached keys.
+    auto size() const noexcept -> span_size_t {
+        const std::lock_guard lock{_mutex};
+        return span_size(_lru.size());
+    }
+
+    /// @brief Evicts all cached keys.
+    void clear() noexcept {
+        trim(0);
+    }
+
+private:
+    using content_hash = std::array<byte, 32>;
+
+    struct content_hash_hash {
+        auto operator()(const content_hash& hash) const noexcept
+          -> std::size_t {
+            std::size_t result{0U};
+            std::memcpy(&result, hash.data(), sizeof(result));
+            return result;
+        }
+    };
+
+    struct entry {
+        content_hash hash{};
+        owned_pkey key;
+    };
+
+    auto _copy(const pkey key) const noexcept -> owned_pkey {
+        if(ok copy{_ssl.copy_pkey(key)}) {
+            return std::move(copy.get());
+        }
+        return {};
+    }
+
+    // adds an entry without a key at the front, all or nothing
+    auto _insert(const content_hash& hash) noexcept -> bool {
+        try {
+            _lru.emplace_front().hash = hash;
+        } catch(const std::bad_alloc&) {
+            return false;
+        }
+        try {
+            _index.emplace(hash, _lru.begin());
+        } catch(const std::bad_alloc&) {
+            _lru.pop_front();
+            return false;
+        }
+        return true;
+    }
+
+    void _evict_last() noexcept {
+        auto& last{_lru.back()};
+        _index.erase(last.hash);
+        _ssl.delete_pkey(std::move(last.key));
+        _lru.pop_back();
+        ++_stats.evictions;
+    }
+
+    const basic_ssl_api<ApiTraits>& _ssl;
+    const std::size_t _capacity;
+    mutable std::mutex _mutex;
+    std::list<entry> _lru;
+    std::unordered_map<
+      content_hash,
+      typename std::list<entry>::iterator,
+      content_hash_hash>
+      _index;
+    key_cache_stats _stats{};
+};
+//------------------------------------------------------------------------------
+export using key_cache = basic_key_cache<ssl_api_traits>;
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
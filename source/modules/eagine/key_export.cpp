@@ -0,0 +1,103 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+export module eagine.sslplus:key_export;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+import eagine.core.utility;
+import :api_traits;
+import :object_handle;
+import :api;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+/// @brief Key derivation functions deriving the key encryption key.
+/// @see private_key_encryption_params
+export enum class key_encryption_kdf { pbkdf2, scrypt };
+
+/// @brief Encodings of exported private keys.
+/// @see private_key_encryption_params
+export enum class private_key_encoding { pem, der };
+
+/// @brief Parameters of encrypted private key export.
+/// @see basic_private_key_writer
+///
+/// Lower costs make the keys faster to load, for example in hot services,
+/// higher costs make them harder to brute-force, for example in cold storage.
+export struct private_key_encryption_params {
+    /// @brief The cipher encrypting the key, AES-256-CBC if empty.
+    cipher_type cipher{};
+    /// @brief The key derivation function.
+    key_encryption_kdf kdf{key_encryption_kdf::pbkdf2};
+    /// @brief The number of PBKDF2 (HMAC-SHA256) iterations.
+    int pbkdf2_iterations{2048};
+    /// @brief The scrypt CPU/memory cost, must be a power of two.
+    std::uint64_t scrypt_n{16384U};
+    /// @brief The scrypt block size.
+    std::uint64_t scrypt_r{8U};
+    /// @brief The scrypt parallelization.
+    std::uint64_t scrypt_p{1U};
+    /// @brief The encoding of the PKCS#8 EncryptedPrivateKeyInfo.
+    private_key_encoding encoding{private_key_encoding::pem};
+};
+//------------------------------------------------------------------------------
+/// @brief Returns the method of BIOs appending all written data to a buffer.
+/// @see set_basic_io_buffer
+export auto buffer_basic_io_method() noexcept -> basic_io_method;
+
+/// @brief Sets the buffer of a BIO created with buffer_basic_io_method.
+/// @note The buffer must outlive the writes into the BIO.
+export void set_basic_io_buffer(const basic_io bio, memory::buffer& dst) noexcept;
+
+/// @brief Writes the private key encrypted with the password into the BIO.
+export auto write_encrypted_pkcs8_private_key(
+  const basic_io bio,
+  const pkey key,
+  const string_view password,
+  const private_key_encryption_params& params) noexcept -> bool;
+//------------------------------------------------------------------------------
+/// @brief Exports private keys as encrypted PKCS#8.
+/// @see basic_ssl_api::parse_private_key
+///
+/// The output is written by OpenSSL directly into the destination buffer,
+/// without the intermediate copy in a memory BIO.
+export template <typename ApiTraits>
+class basic_private_key_writer {
+public:
+    basic_private_key_writer(const basic_ssl_api<ApiTraits>& ssl) noexcept
+      : _ssl{ssl} {}
+
+    /// @brief Writes the encrypted private key into the buffer.
+    /// @return View of dst containing the encoded key or an empty block.
+    auto write(
+      const pkey key,
+      const string_view password,
+      memory::buffer& dst,
+      const private_key_encryption_params& params = {}) const noexcept
+      -> memory::const_block {
+        dst.clear();
+        if(ok bio{_ssl.new_basic_io(buffer_basic_io_method())}) {
+            const auto del_bio{_ssl.delete_basic_io.raii(bio)};
+
+            set_basic_io_buffer(bio, dst);
+            if(write_encrypted_pkcs8_private_key(bio, key, password, params)) {
+                return view(dst);
+            }
+        }
+        dst.clear();
+        return {};
+    }
+
+private:
+    const basic_ssl_api<ApiTraits>& _ssl;
+};
+//------------------------------------------------------------------------------
+export using private_key_writer = basic_private_key_writer<ssl_api_traits>;
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
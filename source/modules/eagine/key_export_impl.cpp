@@ -0,0 +1,156 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+module;
+
+#if __has_include(<openssl/pkcs12.h>)
+#include <openssl/bio.h>
+#include <openssl/evp.h>
+#include <openssl/objects.h>
+#include <openssl/pem.h>
+#include <openssl/pkcs12.h>
+#include <openssl/x509.h>
+
+#define EAGINE_HAS_SSL 1
+#else
+#define EAGINE_HAS_SSL 0
+#endif
+
+module eagine.sslplus;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+#if EAGINE_HAS_SSL
+static auto buffer_bio_write(BIO* bio, const char* data, int size) -> int {
+    auto* dst{static_cast<memory::buffer*>(BIO_get_data(bio))};
+    if(not dst or (size < 0)) {
+        return -1;
+    }
+    // exceptions must not propagate through the OpenSSL frames
+    try {
+        const auto offset{dst->size()};
+        dst->resize(offset + span_size(size));
+        std::memcpy(dst->data() + offset, data, std_size(size));
+    } catch(...) {
+        return -1;
+    }
+    return size;
+}
+
+static auto buffer_bio_puts(BIO* bio, const char* str) -> int {
+    return buffer_bio_write(bio, str, static_cast<int>(std::strlen(str)));
+}
+
+static auto buffer_bio_ctrl(BIO*, int cmd, long, void*) -> long {
+    return cmd == BIO_CTRL_FLUSH ? 1L : 0L;
+}
+
+static auto buffer_bio_create(BIO* bio) -> int {
+    BIO_set_init(bio, 1);
+    return 1;
+}
+
+static auto make_buffer_bio_method() noexcept -> BIO_METHOD* {
+    auto* method{BIO_meth_new(
+      BIO_get_new_index() | BIO_TYPE_SOURCE_SINK, "eagine buffer")};
+    if(method) {
+        BIO_meth_set_write(method, &buffer_bio_write);
+        BIO_meth_set_puts(method, &buffer_bio_puts);
+        BIO_meth_set_ctrl(method, &buffer_bio_ctrl);
+        BIO_meth_set_create(method, &buffer_bio_create);
+    }
+    return method;
+}
+#endif
+//------------------------------------------------------------------------------
+auto buffer_basic_io_method() noexcept -> basic_io_method {
+#if EAGINE_HAS_SSL
+    // shared by all BIOs and kept until exit, like the built-in methods
+    static const BIO_METHOD* method{make_buffer_bio_method()};
+    return basic_io_method{method};
+#else
+    return {};
+#endif
+}
+//------------------------------------------------------------------------------
+void set_basic_io_buffer(
+  [[maybe_unused]] const basic_io bio,
+  [[maybe_unused]] memory::buffer& dst) noexcept {
+#if EAGINE_HAS_SSL
+    if(bio) {
+        BIO_set_data(static_cast<BIO*>(bio), &dst);
+    }
+#endif
+}
+//------------------------------------------------------------------------------
+auto write_encrypted_pkcs8_private_key(
+  [[maybe_unused]] const basic_io bio,
+  [[maybe_unused]] const pkey key,
+  [[maybe_unused]] const string_view password,
+  [[maybe_unused]] const private_key_encryption_params& params) noexcept
+  -> bool {
+#if EAGINE_HAS_SSL
+    if(not bio or not key) {
+        return false;
+    }
+    const auto* cipher{
+      params.cipher ? static_cast<const EVP_CIPHER*>(params.cipher)
+                    : EVP_aes_256_cbc()};
+    // the salt and the IV are generated randomly
+    auto* algorithm{
+      params.kdf == key_encryption_kdf::scrypt
+        ? PKCS5_pbe2_set_scrypt(
+            cipher,
+            nullptr,
+            0,
+            nullptr,
+            params.scrypt_n,
+            params.scrypt_r,
+            params.scrypt_p)
+        : PKCS5_pbe2_set_iv(
+            cipher,
+            params.pbkdf2_iterations,
+            nullptr,
+            0,
+            nullptr,
+            NID_hmacWithSHA256)};
+    if(not algorithm) {
+        return false;
+    }
+    auto* key_info{EVP_PKEY2PKCS8(static_cast<EVP_PKEY*>(key))};
+    if(not key_info) {
+        X509_ALGOR_free(algorithm);
+        return false;
+    }
+    // takes the ownership of the algorithm on success
+    auto* encrypted{PKCS8_set0_pbe(
+      password.data(),
+      static_cast<int>(password.size()),
+      key_info,
+      algorithm)};
+    PKCS8_PRIV_KEY_INFO_free(key_info);
+    if(not encrypted) {
+        X509_ALGOR_free(algorithm);
+        return false;
+    }
+    auto* native_bio{static_cast<BIO*>(bio)};
+    const auto written{
+      params.encoding == private_key_encoding::der
+        ? i2d_PKCS8_bio(native_bio, encrypted)
+        : PEM_write_bio_PKCS8(native_bio, encrypted)};
+    X509_SIG_free(encrypted);
+    return written > 0;
+#else
+    return false;
+#endif
+}
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
@@ -0,0 +1,119 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+export module eagine.sslplus:key_pool;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+import eagine.core.utility;
+import :api_traits;
+import :object_handle;
+import :api;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+/// @brief Pool of keys pre-generated on a background thread.
+/// @see basic_ssl_api::generate_key
+///
+/// The generator thread keeps the pool filled up to the target depth,
+/// so that take() returns a ready key in constant time. If the pool is
+/// drained, the key is generated synchronously on the calling thread.
+export template <typename ApiTraits>
+class basic_key_pool {
+public:
+    basic_key_pool(
+      const basic_ssl_api<ApiTraits>& ssl,
+      const string_view algorithm,
+      const key_generation_params& params,
+      const span_size_t target_depth)
+      : _ssl{ssl}
+      , _algorithm{to_string(algorithm)}
+      , _group_name{to_string(params.group_name)}
+      , _params{.rsa_key_bits = params.rsa_key_bits, .group_name = _group_name}
+      , _target_depth{std_size(target_depth)}
+      , _generator{[this] { _generate(); }} {}
+
+    basic_key_pool(basic_key_pool&&) = delete;
+    basic_key_pool(const basic_key_pool&) = delete;
+    auto operator=(basic_key_pool&&) = delete;
+    auto operator=(const basic_key_pool&) = delete;
+
+    ~basic_key_pool() noexcept {
+        {
+            const std::unique_lock lock{_mutex};
+            _done = true;
+        }
+        _refill.notify_all();
+        _generator.join();
+        for(auto& key : _keys) {
+            _ssl.delete_pkey(std::move(key));
+        }
+    }
+
+    /// @brief Returns the number of currently ready keys.
+    auto size() const noexcept -> span_size_t {
+        const std::unique_lock lock{_mutex};
+        return span_size(_keys.size());
+    }
+
+    /// @brief Returns a ready key or generates a new one if the pool is empty.
+    /// @note The caller takes the ownership of the returned key.
+    auto take() noexcept -> owned_pkey {
+        {
+            const std::unique_lock lock{_mutex};
+            if(not _keys.empty()) {
+                owned_pkey key{std::move(_keys.front())};
+                _keys.pop_front();
+                _refill.notify_one();
+                return key;
+            }
+            _refill.notify_one();
+        }
+        return _ssl.generate_key(_algorithm, _params);
+    }
+
+private:
+    void _generate() noexcept {
+        std::unique_lock lock{_mutex};
+        while(not _done) {
+            if(_keys.size() >= _target_depth) {
+                _refill.wait(lock);
+                continue;
+            }
+            lock.unlock();
+            auto key{_ssl.generate_key(_algorithm, _params)};
+            lock.lock();
+            if(key) {
+                try {
+                    _keys.push_back(std::move(key));
+                } catch(const std::bad_alloc&) {
+                    // stop refilling, take generates the keys on demand
+                    _ssl.delete_pkey(std::move(key));
+                    return;
+                }
+            } else {
+                _refill.wait_for(lock, std::chrono::seconds{1});
+            }
+        }
+    }
+
+    const basic_ssl_api<ApiTraits>& _ssl;
+    const std::string _algorithm;
+    const std::string _group_name;
+    const key_generation_params _params;
+    const std::size_t _target_depth;
+    mutable std::mutex _mutex;
+    std::condition_variable _refill;
+    std::deque<owned_pkey> _keys;
+    bool _done{false};
+    std::thread _generator;
+};
+//------------------------------------------------------------------------------
+export using key_pool = basic_key_pool<ssl_api_traits>;
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
@@ -0,0 +1,148 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+export module eagine.sslplus:library_context;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+import eagine.core.utility;
+import :api_traits;
+import :object_handle;
+import :api;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+/// @brief Options for the library contexts created by library_context_manager.
+/// @see basic_library_context_manager
+export struct library_context_options {
+    /// @brief Names of the providers loaded into each context.
+    std::vector<std::string> providers{"default"};
+    /// @brief Optional path to an OpenSSL configuration file.
+    std::string config_path{};
+    /// @brief Optional provider search path.
+    std::string provider_search_path{};
+};
+//------------------------------------------------------------------------------
+/// @brief Creates and owns one OpenSSL library context per thread.
+/// @see basic_ssl_api::new_lib_ctx
+///
+/// Calling enter() from a thread creates (on first use) a library context
+/// with the configured providers for that thread and makes it the thread's
+/// default context. Algorithm fetches, the DRBG and stores used by calls
+/// with a null library context are then private to the calling thread,
+/// which avoids cross-thread lock contention. All threads must stop using
+/// their contexts before the manager is destroyed.
+export template <typename ApiTraits>
+class basic_library_context_manager {
+public:
+    basic_library_context_manager(
+      const basic_ssl_api<ApiTraits>& ssl,
+      library_context_options options = {})
+      : _ssl{ssl}
+      , _options{std::move(options)} {}
+
+    basic_library_context_manager(basic_library_context_manager&&) = delete;
+    basic_library_context_manager(const basic_library_context_manager&) =
+      delete;
+    auto operator=(basic_library_context_manager&&) = delete;
+    auto operator=(const basic_library_context_manager&) = delete;
+
+    ~basic_library_context_manager() noexcept {
+        leave();
+        const std::unique_lock lock{_mutex};
+        for(auto& [id, ent] : _contexts) {
+            for(const auto prov : ent.providers) {
+                _ssl.unload_provider(prov);
+            }
+            _ssl.delete_lib_ctx(std::move(ent.context));
+        }
+    }
+
+    /// @brief Returns the number of contexts created so far.
+    auto size() const noexcept -> span_size_t {
+        const std::unique_lock lock{_mutex};
+        return span_size(_contexts.size());
+    }
+
+    /// @brief Returns the library context of the calling thread, if any.
+    auto current() const noexcept -> lib_ctx {
+        const std::unique_lock lock{_mutex};
+        const auto pos{_contexts.find(std::this_thread::get_id())};
+        if(pos != _contexts.end()) {
+            return pos->second.context;
+        }
+        return {};
+    }
+
+    /// @brief Makes the own context of the calling thread its default one.
+    /// @return The thread's library context or a null context on failure.
+    auto enter() noexcept -> lib_ctx {
+        lib_ctx ctx{current()};
+        if(not ctx) {
+            ctx = _create();
+        }
+        if(ctx) {
+            _ssl.set_default_lib_ctx(ctx);
+        }
+        return ctx;
+    }
+
+    /// @brief Restores the global default context in the calling thread.
+    void leave() const noexcept {
+        _ssl.set_default_lib_ctx(lib_ctx{});
+    }
+
+private:
+    struct entry {
+        owned_lib_ctx context;
+        std::vector<provider> providers;
+    };
+
+    auto _create() noexcept -> lib_ctx {
+        if(ok created{_ssl.new_lib_ctx()}) {
+            entry ent{.context = std::move(created.get())};
+            bool loaded{true};
+            if(not _options.config_path.empty()) {
+                loaded = bool(
+                  _ssl.load_lib_ctx_config(ent.context, _options.config_path));
+            }
+            if(not _options.provider_search_path.empty()) {
+                _ssl.set_default_provider_search_path(
+                  ent.context, _options.provider_search_path);
+            }
+            for(const auto& name : _options.providers) {
+                if(ok prov{_ssl.load_provider(ent.context, name)}) {
+                    ent.providers.push_back(prov.get());
+                } else {
+                    loaded = false;
+                }
+            }
+            if(loaded) {
+                const lib_ctx result{ent.context};
+                const std::unique_lock lock{_mutex};
+                _contexts.emplace(std::this_thread::get_id(), std::move(ent));
+                return result;
+            }
+            for(const auto prov : ent.providers) {
+                _ssl.unload_provider(prov);
+            }
+            _ssl.delete_lib_ctx(std::move(ent.context));
+        }
+        return {};
+    }
+
+    const basic_ssl_api<ApiTraits>& _ssl;
+    const library_context_options _options;
+    mutable std::mutex _mutex;
+    std::map<std::thread::id, entry> _contexts;
+};
+//------------------------------------------------------------------------------
+export using library_context_manager =
+  basic_library_context_manager<ssl_api_traits>;
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
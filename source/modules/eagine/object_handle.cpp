@@ -17,6 +17,8 @@ export using ui_method_tag = EAGINE_SSLPLUS_TAG_TYPE(UIMethod);
 export using dispatch_tag = EAGINE_SSLPLUS_TAG_TYPE(Dispatch);
 export using core_handle_tag = EAGINE_SSLPLUS_TAG_TYPE(CoreHandle);
 export using lib_ctx_tag = EAGINE_SSLPLUS_TAG_TYPE(LibCtx);
+export using param_list_tag = EAGINE_SSLPLUS_TAG_TYPE(ParamList);
+export using param_builder_tag = EAGINE_SSLPLUS_TAG_TYPE(ParamBuild);
 export using provider_tag = EAGINE_SSLPLUS_TAG_TYPE(Provider);
 export using engine_tag = EAGINE_SSLPLUS_TAG_TYPE(Engine);
 export using asn1_object_tag = EAGINE_SSLPLUS_TAG_TYPE(ASN1Object);
@@ -26,8 +28,20 @@ export using basic_io_tag = EAGINE_SSLPLUS_TAG_TYPE(BIO);
 export using basic_io_method_tag = EAGINE_SSLPLUS_TAG_TYPE(BIOMethod);
 export using cipher_type_tag = EAGINE_SSLPLUS_TAG_TYPE(CipherType);
 export using cipher_tag = EAGINE_SSLPLUS_TAG_TYPE(Cipher);
+export using cipher_algorithm_tag = EAGINE_SSLPLUS_TAG_TYPE(CipherAlg);
+export using kdf_tag = EAGINE_SSLPLUS_TAG_TYPE(KDF);
+export using kdf_ctx_tag = EAGINE_SSLPLUS_TAG_TYPE(KDFCtx);
+export using mac_algorithm_tag = EAGINE_SSLPLUS_TAG_TYPE(MACAlg);
 export using message_digest_type_tag = EAGINE_SSLPLUS_TAG_TYPE(MsgDgstTyp);
 export using message_digest_tag = EAGINE_SSLPLUS_TAG_TYPE(MsgDigest);
+export using message_digest_algorithm_tag =
+  EAGINE_SSLPLUS_TAG_TYPE(MsgDgstAlg);
+export using ocsp_basic_response_tag = EAGINE_SSLPLUS_TAG_TYPE(OCSPBasic);
+export using ocsp_cert_id_tag = EAGINE_SSLPLUS_TAG_TYPE(OCSPCertId);
+export using ocsp_one_request_tag = EAGINE_SSLPLUS_TAG_TYPE(OCSPOneReq);
+export using ocsp_request_tag = EAGINE_SSLPLUS_TAG_TYPE(OCSPReq);
+export using ocsp_response_tag = EAGINE_SSLPLUS_TAG_TYPE(OCSPResp);
+export using general_name_tag = EAGINE_SSLPLUS_TAG_TYPE(GenName);
 export using pkey_tag = EAGINE_SSLPLUS_TAG_TYPE(PKey);
 export using pkey_ctx_tag = EAGINE_SSLPLUS_TAG_TYPE(PKeyCtx);
 export using x509_lookup_method_tag = EAGINE_SSLPLUS_TAG_TYPE(X509LkpMtd);
@@ -37,6 +51,7 @@ export using x509_name_entry_tag = EAGINE_SSLPLUS_TAG_TYPE(X509NamEnt);
 export using x509_store_ctx_tag = EAGINE_SSLPLUS_TAG_TYPE(X509StrCtx);
 export using x509_store_tag = EAGINE_SSLPLUS_TAG_TYPE(X509Store);
 export using x509_crl_tag = EAGINE_SSLPLUS_TAG_TYPE(X509Crl);
+export using x509_extension_tag = EAGINE_SSLPLUS_TAG_TYPE(X509Ext);
 export using x509_tag = EAGINE_SSLPLUS_TAG_TYPE(X509);
 #undef EAGINE_SSLPLUS_TAG_TYPE
 //------------------------------------------------------------------------------
@@ -52,6 +67,12 @@ export using core_handle =
 export using lib_ctx =
   c_api::basic_handle<lib_ctx_tag, ssl_types::lib_ctx_type*, nullptr>;
 
+export using param_list =
+  c_api::basic_handle<param_list_tag, ssl_types::param_type*, nullptr>;
+
+export using param_builder = c_api::
+  basic_handle<param_builder_tag, ssl_types::param_bld_type*, nullptr>;
+
 export using provider =
   c_api::basic_handle<provider_tag, ssl_types::provider_type*, nullptr>;
 
@@ -79,12 +100,48 @@ export using cipher_type = c_api::
 export using cipher =
   c_api::basic_handle<cipher_tag, ssl_types::evp_cipher_ctx_type*, nullptr>;
 
+export using cipher_algorithm = c_api::
+  basic_handle<cipher_algorithm_tag, ssl_types::evp_cipher_type*, nullptr>;
+
+export using kdf =
+  c_api::basic_handle<kdf_tag, ssl_types::evp_kdf_type*, nullptr>;
+
+export using kdf_ctx =
+  c_api::basic_handle<kdf_ctx_tag, ssl_types::evp_kdf_ctx_type*, nullptr>;
+
+export using mac_algorithm =
+  c_api::basic_handle<mac_algorithm_tag, ssl_types::evp_mac_type*, nullptr>;
+
 export using message_digest_type = c_api::
   basic_handle<message_digest_type_tag, const ssl_types::evp_md_type*, nullptr>;
 
 export using message_digest =
   c_api::basic_handle<message_digest_tag, ssl_types::evp_md_ctx_type*, nullptr>;
 
+export using message_digest_algorithm = c_api::basic_handle<
+  message_digest_algorithm_tag,
+  ssl_types::evp_md_type*,
+  nullptr>;
+
+export using ocsp_basic_response = c_api::basic_handle<
+  ocsp_basic_response_tag,
+  ssl_types::ocsp_basic_response_type*,
+  nullptr>;
+
+export using ocsp_cert_id =
+  c_api::basic_handle<ocsp_cert_id_tag, ssl_types::ocsp_cert_id_type*, nullptr>;
+
+export using ocsp_one_request = c_api::basic_handle<
+  ocsp_one_request_tag,
+  ssl_types::ocsp_one_request_type*,
+  nullptr>;
+
+export using ocsp_request =
+  c_api::basic_handle<ocsp_request_tag, ssl_types::ocsp_request_type*, nullptr>;
+
+export using ocsp_response = c_api::
+  basic_handle<ocsp_response_tag, ssl_types::ocsp_response_type*, nullptr>;
+
 export using pkey =
   c_api::basic_handle<pkey_tag, ssl_types::evp_pkey_type*, nullptr>;
 
@@ -96,6 +153,9 @@ export using x509_lookup_method = c_api::basic_handle<
   ssl_types::x509_lookup_method_type*,
   nullptr>;
 
+export using x509_lookup =
+  c_api::basic_handle<x509_lookup_tag, ssl_types::x509_lookup_type*, nullptr>;
+
 export using x509_name =
   c_api::basic_handle<x509_name_tag, const ssl_types::x509_name_type*, nullptr>;
 
@@ -113,6 +173,12 @@ export using x509_store =
 export using x509_crl =
   c_api::basic_handle<x509_crl_tag, ssl_types::x509_crl_type*, nullptr>;
 
+export using x509_extension = c_api::
+  basic_handle<x509_extension_tag, ssl_types::x509_extension_type*, nullptr>;
+
+export using general_name =
+  c_api::basic_handle<general_name_tag, ssl_types::general_name_type*, nullptr>;
+
 export using x509 =
   c_api::basic_handle<x509_tag, ssl_types::x509_type*, nullptr>;
 //------------------------------------------------------------------------------
@@ -125,6 +191,12 @@ export using owned_core_handle = c_api::
 export using owned_lib_ctx =
   c_api::basic_owned_handle<lib_ctx_tag, ssl_types::lib_ctx_type*, nullptr>;
 
+export using owned_param_list =
+  c_api::basic_owned_handle<param_list_tag, ssl_types::param_type*, nullptr>;
+
+export using owned_param_builder = c_api::
+  basic_owned_handle<param_builder_tag, ssl_types::param_bld_type*, nullptr>;
+
 export using owned_provider =
   c_api::basic_owned_handle<provider_tag, ssl_types::provider_type*, nullptr>;
 
@@ -137,12 +209,48 @@ export using owned_basic_io =
 export using owned_cipher =
   c_api::basic_owned_handle<cipher_tag, ssl_types::evp_cipher_ctx_type*, nullptr>;
 
+export using owned_cipher_algorithm = c_api::
+  basic_owned_handle<cipher_algorithm_tag, ssl_types::evp_cipher_type*, nullptr>;
+
+export using owned_kdf =
+  c_api::basic_owned_handle<kdf_tag, ssl_types::evp_kdf_type*, nullptr>;
+
+export using owned_kdf_ctx =
+  c_api::basic_owned_handle<kdf_ctx_tag, ssl_types::evp_kdf_ctx_type*, nullptr>;
+
+export using owned_mac_algorithm = c_api::
+  basic_owned_handle<mac_algorithm_tag, ssl_types::evp_mac_type*, nullptr>;
+
 export using owned_message_digest = c_api::
   basic_owned_handle<message_digest_tag, ssl_types::evp_md_ctx_type*, nullptr>;
 
+export using owned_message_digest_algorithm = c_api::basic_owned_handle<
+  message_digest_algorithm_tag,
+  ssl_types::evp_md_type*,
+  nullptr>;
+
+export using owned_ocsp_basic_response = c_api::basic_owned_handle<
+  ocsp_basic_response_tag,
+  ssl_types::ocsp_basic_response_type*,
+  nullptr>;
+
+export using owned_ocsp_cert_id = c_api::
+  basic_owned_handle<ocsp_cert_id_tag, ssl_types::ocsp_cert_id_type*, nullptr>;
+
+export using owned_ocsp_request = c_api::
+  basic_owned_handle<ocsp_request_tag, ssl_types::ocsp_request_type*, nullptr>;
+
+export using owned_ocsp_response = c_api::basic_owned_handle<
+  ocsp_response_tag,
+  ssl_types::ocsp_response_type*,
+  nullptr>;
+
 export using owned_pkey =
   c_api::basic_owned_handle<pkey_tag, ssl_types::evp_pkey_type*, nullptr>;
 
+export using owned_pkey_ctx = c_api::
+  basic_owned_handle<pkey_ctx_tag, ssl_types::evp_pkey_ctx_type*, nullptr>;
+
 export using owned_x509_store_ctx = c_api::basic_owned_handle<
   x509_store_ctx_tag,
   ssl_types::x509_store_ctx_type*,
@@ -154,6 +262,14 @@ export using owned_x509_store =
 export using owned_x509_crl =
   c_api::basic_owned_handle<x509_crl_tag, ssl_types::x509_crl_type*, nullptr>;
 
+export using owned_x509_extension = c_api::basic_owned_handle<
+  x509_extension_tag,
+  ssl_types::x509_extension_type*,
+  nullptr>;
+
+export using owned_general_name = c_api::
+  basic_owned_handle<general_name_tag, ssl_types::general_name_type*, nullptr>;
+
 export using owned_x509 =
   c_api::basic_owned_handle<x509_tag, ssl_types::x509_type*, nullptr>;
 //------------------------------------------------------------------------------
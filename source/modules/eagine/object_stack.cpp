@@ -48,34 +48,206 @@ public:
     }
 };
 //------------------------------------------------------------------------------
+/// @brief Type-independent operations on OpenSSL stacks.
+/// @see stack_api
+export template <typename Stack, typename Element>
+struct basic_stack_api {
+    using stack_type = Stack;
+    using element_type = Element;
+
+    auto new_null() const noexcept -> stack_type*;
+
+    void free(stack_type* h) const noexcept;
+
+    auto num(stack_type* h) const noexcept -> int;
+
+    /// @brief Pre-allocates space for n additional elements.
+    auto reserve(stack_type* h, const int n) const noexcept -> bool;
+
+    auto push(stack_type* h, element_type* e) const noexcept -> int;
+
+    auto pop(stack_type* h) const noexcept -> element_type*;
+
+    auto set(stack_type* h, const int i, element_type* e) const noexcept
+      -> element_type*;
+
+    auto value(stack_type* h, const int i) const noexcept -> element_type*;
+};
+
+extern template struct basic_stack_api<
+  ssl_types::x509_stack_type,
+  ssl_types::x509_type>;
+extern template struct basic_stack_api<
+  ssl_types::x509_crl_stack_type,
+  ssl_types::x509_crl_type>;
+extern template struct basic_stack_api<
+  ssl_types::x509_extension_stack_type,
+  ssl_types::x509_extension_type>;
+extern template struct basic_stack_api<
+  ssl_types::general_name_stack_type,
+  ssl_types::general_name_type>;
+extern template struct basic_stack_api<
+  ssl_types::x509_name_entry_stack_type,
+  ssl_types::x509_name_entry_type>;
+//------------------------------------------------------------------------------
 export template <typename Tag>
 struct stack_api;
 //------------------------------------------------------------------------------
 export template <>
-struct stack_api<x509_tag> {
-    using stack_type = ssl_types::x509_stack_type;
-    using element_type = ssl_types::x509_type;
+struct stack_api<x509_tag>
+  : basic_stack_api<ssl_types::x509_stack_type, ssl_types::x509_type> {
 
     auto unpack(x509 obj) const noexcept -> element_type*;
 
-    auto new_null() const noexcept -> stack_type*;
-
-    void free(stack_type* h) const noexcept;
+    auto push_up_ref(stack_type* h, element_type* e) const noexcept -> int;
 
-    auto num(stack_type* h) const noexcept -> int;
+    void pop_free(stack_type* h) const noexcept;
+};
+//------------------------------------------------------------------------------
+export template <>
+struct stack_api<x509_crl_tag>
+  : basic_stack_api<ssl_types::x509_crl_stack_type, ssl_types::x509_crl_type> {
 
-    auto push(stack_type* h, element_type* e) const noexcept -> int;
+    auto unpack(x509_crl obj) const noexcept -> element_type*;
 
     auto push_up_ref(stack_type* h, element_type* e) const noexcept -> int;
 
-    auto pop(stack_type* h) const noexcept -> element_type*;
+    void pop_free(stack_type* h) const noexcept;
+};
+//------------------------------------------------------------------------------
+export template <>
+struct stack_api<x509_extension_tag>
+  : basic_stack_api<
+      ssl_types::x509_extension_stack_type,
+      ssl_types::x509_extension_type> {
+
+    auto unpack(x509_extension obj) const noexcept -> element_type*;
 
     void pop_free(stack_type* h) const noexcept;
+};
+//------------------------------------------------------------------------------
+export template <>
+struct stack_api<general_name_tag>
+  : basic_stack_api<
+      ssl_types::general_name_stack_type,
+      ssl_types::general_name_type> {
 
-    auto set(stack_type* h, const int i, element_type* e) const noexcept
-      -> element_type*;
+    auto unpack(general_name obj) const noexcept -> element_type*;
 
-    auto value(stack_type* h, const int i) noexcept -> element_type*;
+    void pop_free(stack_type* h) const noexcept;
+};
+//------------------------------------------------------------------------------
+export template <>
+struct stack_api<x509_name_entry_tag>
+  : basic_stack_api<
+      ssl_types::x509_name_entry_stack_type,
+      ssl_types::x509_name_entry_type> {
+
+    auto unpack(x509_name_entry obj) const noexcept -> element_type*;
+
+    void pop_free(stack_type* h) const noexcept;
+};
+//------------------------------------------------------------------------------
+// object_stack_iterator
+//------------------------------------------------------------------------------
+/// @brief Random-access iterator over the elements of an object_stack.
+/// @note Dereferencing returns the element handle by value.
+export template <typename Handle>
+class object_stack_iterator;
+
+export template <typename Tag, typename T>
+class object_stack_iterator<c_api::basic_handle<Tag, T*, nullptr>> {
+    using stack_type = typename stack_api<Tag>::stack_type;
+
+public:
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type = c_api::basic_handle<Tag, T*, nullptr>;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type;
+
+    constexpr object_stack_iterator() noexcept = default;
+    constexpr object_stack_iterator(stack_type* top, const int pos) noexcept
+      : _top{top}
+      , _pos{pos} {}
+
+    auto operator*() const noexcept -> value_type {
+        return value_type{stack_api<Tag>{}.value(_top, _pos)};
+    }
+
+    auto operator[](const difference_type offs) const noexcept -> value_type {
+        return *(*this + offs);
+    }
+
+    constexpr auto operator++() noexcept -> object_stack_iterator& {
+        ++_pos;
+        return *this;
+    }
+
+    constexpr auto operator++(int) noexcept -> object_stack_iterator {
+        return {_top, _pos++};
+    }
+
+    constexpr auto operator--() noexcept -> object_stack_iterator& {
+        --_pos;
+        return *this;
+    }
+
+    constexpr auto operator--(int) noexcept -> object_stack_iterator {
+        return {_top, _pos--};
+    }
+
+    constexpr auto operator+=(const difference_type offs) noexcept
+      -> object_stack_iterator& {
+        _pos += static_cast<int>(offs);
+        return *this;
+    }
+
+    constexpr auto operator-=(const difference_type offs) noexcept
+      -> object_stack_iterator& {
+        _pos -= static_cast<int>(offs);
+        return *this;
+    }
+
+    friend constexpr auto operator+(
+      object_stack_iterator it,
+      const difference_type offs) noexcept -> object_stack_iterator {
+        return it += offs;
+    }
+
+    friend constexpr auto operator+(
+      const difference_type offs,
+      object_stack_iterator it) noexcept -> object_stack_iterator {
+        return it += offs;
+    }
+
+    friend constexpr auto operator-(
+      object_stack_iterator it,
+      const difference_type offs) noexcept -> object_stack_iterator {
+        return it -= offs;
+    }
+
+    friend constexpr auto operator-(
+      const object_stack_iterator& l,
+      const object_stack_iterator& r) noexcept -> difference_type {
+        return difference_type(l._pos) - difference_type(r._pos);
+    }
+
+    friend constexpr auto operator==(
+      const object_stack_iterator& l,
+      const object_stack_iterator& r) noexcept -> bool {
+        return l._pos == r._pos;
+    }
+
+    friend constexpr auto operator<=>(
+      const object_stack_iterator& l,
+      const object_stack_iterator& r) noexcept {
+        return l._pos <=> r._pos;
+    }
+
+private:
+    stack_type* _top{nullptr};
+    int _pos{0};
 };
 //------------------------------------------------------------------------------
 // object_stack_base
@@ -103,6 +275,8 @@ protected:
 
 public:
     using wrapper = c_api::basic_handle<Tag, T*, nullptr>;
+    using iterator = object_stack_iterator<wrapper>;
+    using const_iterator = iterator;
 
     object_stack_base(object_stack_base&& temp) noexcept
       : _top{temp._top} {
@@ -123,11 +297,28 @@ public:
         return _api().num(_top);
     }
 
-    auto get(const int pos) noexcept {
+    auto empty() const noexcept -> bool {
+        return size() == 0;
+    }
+
+    /// @brief Pre-allocates space for count additional elements.
+    auto reserve(const int count) noexcept -> bool {
+        return _api().reserve(_top, count);
+    }
+
+    auto get(const int pos) const noexcept {
         assert(_idx_ok(pos));
         return wrapper{_api().value(_top, pos)};
     }
 
+    auto begin() const noexcept -> iterator {
+        return {_top, 0};
+    }
+
+    auto end() const noexcept -> iterator {
+        return {_top, size()};
+    }
+
     auto native() const noexcept -> auto* {
         return _top;
     }
@@ -149,13 +340,15 @@ public:
     object_stack() noexcept
       : base{_api().new_null()} {}
 
-    object_stack(object_stack&&) noexcept = delete;
+    object_stack(object_stack&&) noexcept = default;
     object_stack(const object_stack&) = delete;
     auto operator=(object_stack&&) noexcept -> object_stack& = default;
     auto operator=(const object_stack&) = delete;
 
     ~object_stack() noexcept {
-        _api().free(this->_top);
+        if(this->_top) {
+            _api().free(this->_top);
+        }
     }
 
     auto push(wrapper obj) noexcept -> auto& {
@@ -163,6 +356,16 @@ public:
         return *this;
     }
 
+    /// @brief Pushes all handles from the range, allocating space only once.
+    template <typename Range>
+    auto push_all(const Range& objs) noexcept -> auto& {
+        this->reserve(static_cast<int>(std::ranges::size(objs)));
+        for(const wrapper obj : objs) {
+            _api().push(this->_top, _api().unpack(obj));
+        }
+        return *this;
+    }
+
     auto pop() noexcept {
         return wrapper{_api().pop(this->_top)};
     }
@@ -184,17 +387,30 @@ public:
     object_stack() noexcept
       : base{_api().new_null()} {}
 
-    object_stack(object_stack&&) noexcept = delete;
+    object_stack(object_stack&&) noexcept = default;
     object_stack(const object_stack&) = delete;
     auto operator=(object_stack&&) noexcept -> object_stack& = default;
     auto operator=(const object_stack&) = delete;
 
+    /// @brief Adopts a native stack owning references to its elements.
+    explicit object_stack(typename stack_api<Tag>::stack_type* top) noexcept
+      : base{top} {}
+
     ~object_stack() noexcept {
-        _api.pop_free()(this->_top);
+        if(this->_top) {
+            _api().pop_free(this->_top);
+        }
     }
 
     auto push(wrapper&& obj) noexcept -> auto& {
-        _api().push_up_ref(this->_top, _api().unpack(obj.release()));
+        _api().push(
+          this->_top, _api().unpack(typename base::wrapper{obj.release()}));
+        return *this;
+    }
+
+    /// @brief Pushes the object incrementing its reference count.
+    auto push_ref(typename base::wrapper obj) noexcept -> auto& {
+        _api().push_up_ref(this->_top, _api().unpack(obj));
         return *this;
     }
 
@@ -9,6 +9,7 @@ module;
 
 #if __has_include(<openssl/x509.h>)
 #include <openssl/x509.h>
+#include <openssl/x509v3.h>
 
 #define EAGINE_HAS_SSL 1
 #else
@@ -19,29 +20,28 @@ module eagine.sslplus;
 
 namespace eagine::sslplus {
 //------------------------------------------------------------------------------
-auto stack_api<x509_tag>::unpack(x509 obj) const noexcept -> element_type* {
-#if EAGINE_HAS_SSL
-    return static_cast<element_type*>(obj);
-#else
-    return nullptr;
-#endif
-}
+// basic_stack_api
 //------------------------------------------------------------------------------
-auto stack_api<x509_tag>::new_null() const noexcept -> stack_type* {
+template <typename Stack, typename Element>
+auto basic_stack_api<Stack, Element>::new_null() const noexcept
+  -> stack_type* {
 #if EAGINE_HAS_SSL
-    return sk_X509_new_null();
+    return reinterpret_cast<stack_type*>(OPENSSL_sk_new_null());
 #else
     return nullptr;
 #endif
 }
 //------------------------------------------------------------------------------
-void stack_api<x509_tag>::free(stack_type* h) const noexcept {
+template <typename Stack, typename Element>
+void basic_stack_api<Stack, Element>::free(stack_type* h) const noexcept {
 #if EAGINE_HAS_SSL
     return OPENSSL_sk_free(reinterpret_cast<OPENSSL_STACK*>(h));
 #endif
 }
 //------------------------------------------------------------------------------
-auto stack_api<x509_tag>::num(stack_type* h) const noexcept -> int {
+template <typename Stack, typename Element>
+auto basic_stack_api<Stack, Element>::num(stack_type* h) const noexcept
+  -> int {
 #if EAGINE_HAS_SSL
     return OPENSSL_sk_num(reinterpret_cast<const OPENSSL_STACK*>(h));
 #else
@@ -49,8 +49,21 @@ auto stack_api<x509_tag>::num(stack_type* h) const noexcept -> int {
 #endif
 }
 //------------------------------------------------------------------------------
-auto stack_api<x509_tag>::push(stack_type* h, element_type* e) const noexcept
-  -> int {
+template <typename Stack, typename Element>
+auto basic_stack_api<Stack, Element>::reserve(
+  [[maybe_unused]] stack_type* h,
+  [[maybe_unused]] const int n) const noexcept -> bool {
+#if EAGINE_HAS_SSL
+    return OPENSSL_sk_reserve(reinterpret_cast<OPENSSL_STACK*>(h), n) != 0;
+#else
+    return false;
+#endif
+}
+//------------------------------------------------------------------------------
+template <typename Stack, typename Element>
+auto basic_stack_api<Stack, Element>::push(
+  stack_type* h,
+  element_type* e) const noexcept -> int {
 #if EAGINE_HAS_SSL
     return OPENSSL_sk_push(reinterpret_cast<OPENSSL_STACK*>(h), e);
 #else
@@ -58,6 +71,67 @@ auto stack_api<x509_tag>::push(stack_type* h, element_type* e) const noexcept
 #endif
 }
 //------------------------------------------------------------------------------
+template <typename Stack, typename Element>
+auto basic_stack_api<Stack, Element>::pop(stack_type* h) const noexcept
+  -> element_type* {
+#if EAGINE_HAS_SSL
+    return static_cast<element_type*>(
+      OPENSSL_sk_pop(reinterpret_cast<OPENSSL_STACK*>(h)));
+#else
+    return nullptr;
+#endif
+}
+//------------------------------------------------------------------------------
+template <typename Stack, typename Element>
+auto basic_stack_api<Stack, Element>::set(
+  stack_type* h,
+  const int i,
+  element_type* e) const noexcept -> element_type* {
+#if EAGINE_HAS_SSL
+    return static_cast<element_type*>(
+      OPENSSL_sk_set(reinterpret_cast<OPENSSL_STACK*>(h), i, e));
+#else
+    return nullptr;
+#endif
+}
+//------------------------------------------------------------------------------
+template <typename Stack, typename Element>
+auto basic_stack_api<Stack, Element>::value(stack_type* h, const int i)
+  const noexcept -> element_type* {
+#if EAGINE_HAS_SSL
+    return static_cast<element_type*>(
+      OPENSSL_sk_value(reinterpret_cast<OPENSSL_STACK*>(h), i));
+#else
+    return nullptr;
+#endif
+}
+//------------------------------------------------------------------------------
+template struct basic_stack_api<
+  ssl_types::x509_stack_type,
+  ssl_types::x509_type>;
+template struct basic_stack_api<
+  ssl_types::x509_crl_stack_type,
+  ssl_types::x509_crl_type>;
+template struct basic_stack_api<
+  ssl_types::x509_extension_stack_type,
+  ssl_types::x509_extension_type>;
+template struct basic_stack_api<
+  ssl_types::general_name_stack_type,
+  ssl_types::general_name_type>;
+template struct basic_stack_api<
+  ssl_types::x509_name_entry_stack_type,
+  ssl_types::x509_name_entry_type>;
+//------------------------------------------------------------------------------
+// x509
+//------------------------------------------------------------------------------
+auto stack_api<x509_tag>::unpack(x509 obj) const noexcept -> element_type* {
+#if EAGINE_HAS_SSL
+    return static_cast<element_type*>(obj);
+#else
+    return nullptr;
+#endif
+}
+//------------------------------------------------------------------------------
 auto stack_api<x509_tag>::push_up_ref(stack_type* h, element_type* e) const noexcept
   -> int {
 #if EAGINE_HAS_SSL
@@ -68,41 +142,99 @@ auto stack_api<x509_tag>::push_up_ref(stack_type* h, element_type* e) const noex
 #endif
 }
 //------------------------------------------------------------------------------
-auto stack_api<x509_tag>::pop(stack_type* h) const noexcept -> element_type* {
+void stack_api<x509_tag>::pop_free(stack_type* h) const noexcept {
 #if EAGINE_HAS_SSL
-    return static_cast<element_type*>(
-      OPENSSL_sk_pop(reinterpret_cast<OPENSSL_STACK*>(h)));
+    OPENSSL_sk_pop_free(
+      reinterpret_cast<OPENSSL_STACK*>(h),
+      reinterpret_cast<void (*)(void*)>(&X509_free));
+#endif
+}
+//------------------------------------------------------------------------------
+// x509_crl
+//------------------------------------------------------------------------------
+auto stack_api<x509_crl_tag>::unpack(x509_crl obj) const noexcept
+  -> element_type* {
+#if EAGINE_HAS_SSL
+    return static_cast<element_type*>(obj);
 #else
     return nullptr;
 #endif
 }
 //------------------------------------------------------------------------------
-void stack_api<x509_tag>::pop_free(stack_type* h) const noexcept {
+auto stack_api<x509_crl_tag>::push_up_ref(stack_type* h, element_type* e)
+  const noexcept -> int {
+#if EAGINE_HAS_SSL
+    X509_CRL_up_ref(e);
+    return OPENSSL_sk_push(reinterpret_cast<OPENSSL_STACK*>(h), e);
+#else
+    return 1;
+#endif
+}
+//------------------------------------------------------------------------------
+void stack_api<x509_crl_tag>::pop_free(stack_type* h) const noexcept {
 #if EAGINE_HAS_SSL
     OPENSSL_sk_pop_free(
       reinterpret_cast<OPENSSL_STACK*>(h),
-      reinterpret_cast<void (*)(void*)>(&X509_free));
+      reinterpret_cast<void (*)(void*)>(&X509_CRL_free));
 #endif
 }
 //------------------------------------------------------------------------------
-auto stack_api<x509_tag>::set(stack_type* h, const int i, element_type* e)
-  const noexcept -> element_type* {
+// x509_extension
+//------------------------------------------------------------------------------
+auto stack_api<x509_extension_tag>::unpack(x509_extension obj) const noexcept
+  -> element_type* {
 #if EAGINE_HAS_SSL
-    return static_cast<element_type*>(
-      OPENSSL_sk_set(reinterpret_cast<OPENSSL_STACK*>(h), i, e));
+    return static_cast<element_type*>(obj);
+#else
+    return nullptr;
+#endif
+}
+//------------------------------------------------------------------------------
+void stack_api<x509_extension_tag>::pop_free(stack_type* h) const noexcept {
+#if EAGINE_HAS_SSL
+    OPENSSL_sk_pop_free(
+      reinterpret_cast<OPENSSL_STACK*>(h),
+      reinterpret_cast<void (*)(void*)>(&X509_EXTENSION_free));
+#endif
+}
+//------------------------------------------------------------------------------
+// general_name
+//------------------------------------------------------------------------------
+auto stack_api<general_name_tag>::unpack(general_name obj) const noexcept
+  -> element_type* {
+#if EAGINE_HAS_SSL
+    return static_cast<element_type*>(obj);
 #else
     return nullptr;
 #endif
 }
 //------------------------------------------------------------------------------
-auto stack_api<x509_tag>::value(stack_type* h, const int i) noexcept
+void stack_api<general_name_tag>::pop_free(stack_type* h) const noexcept {
+#if EAGINE_HAS_SSL
+    OPENSSL_sk_pop_free(
+      reinterpret_cast<OPENSSL_STACK*>(h),
+      reinterpret_cast<void (*)(void*)>(&GENERAL_NAME_free));
+#endif
+}
+//------------------------------------------------------------------------------
+// x509_name_entry
+//------------------------------------------------------------------------------
+auto stack_api<x509_name_entry_tag>::unpack(x509_name_entry obj) const noexcept
   -> element_type* {
 #if EAGINE_HAS_SSL
-    return static_cast<element_type*>(
-      OPENSSL_sk_value(reinterpret_cast<OPENSSL_STACK*>(h), i));
+    return const_cast<element_type*>(
+      static_cast<const element_type*>(obj));
 #else
     return nullptr;
 #endif
 }
 //------------------------------------------------------------------------------
+void stack_api<x509_name_entry_tag>::pop_free(stack_type* h) const noexcept {
+#if EAGINE_HAS_SSL
+    OPENSSL_sk_pop_free(
+      reinterpret_cast<OPENSSL_STACK*>(h),
+      reinterpret_cast<void (*)(void*)>(&X509_NAME_ENTRY_free));
+#endif
+}
+//------------------------------------------------------------------------------
 } // namespace eagine::sslplus
@@ -0,0 +1,560 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+export module eagine.sslplus:ocsp;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+import eagine.core.utility;
+import eagine.core.c_api;
+import :api_traits;
+import :object_handle;
+import :object_stack;
+import :api;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+/// @brief The revocation status of a certificate reported by OCSP.
+export enum class ocsp_cert_status : int { good = 0, revoked = 1, unknown = 2 };
+
+/// @brief The status of a single certificate in an OCSP response.
+export struct ocsp_single_status {
+    ocsp_cert_status status{ocsp_cert_status::unknown};
+    /// @brief The CRL reason code of a revocation, negative if not specified.
+    int reason{-1};
+    std::chrono::system_clock::time_point revocation_time{};
+    std::chrono::system_clock::time_point this_update{};
+    std::optional<std::chrono::system_clock::time_point> next_update{};
+};
+//------------------------------------------------------------------------------
+/// @brief Finds the status of the certificate with the specified id.
+export auto find_ocsp_status(
+  const ocsp_basic_response basic,
+  const ocsp_cert_id cert_id) noexcept -> std::optional<ocsp_single_status>;
+
+/// @brief Encodes the OCSP request into DER, replacing the content of dst.
+export auto encode_ocsp_request(
+  const ocsp_request request,
+  std::vector<byte>& dst) -> bool;
+
+/// @brief Encodes the OCSP certificate id into DER, replacing the content of dst.
+export auto encode_ocsp_cert_id(const ocsp_cert_id cert_id, std::string& dst)
+  -> bool;
+
+/// @brief Returns the bytes of the serial number in the certificate id.
+/// @note The returned block is owned by the certificate id.
+export auto get_ocsp_cert_id_serial(const ocsp_cert_id cert_id) noexcept
+  -> memory::const_block;
+
+/// @brief Parses a DER encoded OCSP response.
+export auto parse_ocsp_response(const memory::const_block der) noexcept
+  -> owned_ocsp_response;
+
+/// @brief Parameters of a single-certificate OCSP response.
+/// @see make_ocsp_response
+export struct ocsp_response_spec {
+    ocsp_cert_id cert_id{};
+    x509 signer{};
+    pkey signer_key{};
+    ocsp_cert_status status{ocsp_cert_status::good};
+    int reason{-1};
+    std::chrono::system_clock::time_point revocation_time{};
+    std::chrono::system_clock::time_point this_update{};
+    std::chrono::system_clock::time_point next_update{};
+};
+
+/// @brief Builds a signed DER encoded OCSP response, replacing the content of dst.
+export auto make_ocsp_response(
+  const ocsp_response_spec& spec,
+  std::vector<byte>& dst) -> bool;
+//------------------------------------------------------------------------------
+/// @brief Returns the lowercase hexadecimal representation of a serial number.
+export auto ocsp_serial_hex(const memory::const_block serial) -> std::string {
+    static constexpr const std::string_view digits{"0123456789abcdef"};
+    std::string result;
+    result.reserve(std_size(serial.size()) * 2U);
+    for(const auto b : serial) {
+        result.push_back(digits[(unsigned(b) >> 4U) & 0x0FU]);
+        result.push_back(digits[unsigned(b) & 0x0FU]);
+    }
+    return result;
+}
+//------------------------------------------------------------------------------
+/// @brief Query passed to an OCSP responder.
+/// @see ocsp_responder
+export struct ocsp_query {
+    /// @brief The id of the queried certificate.
+    ocsp_cert_id cert_id{};
+    /// @brief The DER encoded OCSP request.
+    memory::const_block request{};
+    /// @brief The serial number of the queried certificate in hexadecimal.
+    string_view serial{};
+};
+
+/// @brief Interface for OCSP responders, or their stand-ins.
+/// @see basic_ocsp_cache
+export struct ocsp_responder : interface<ocsp_responder> {
+    /// @brief Returns the DER encoded response to the query, empty on failure.
+    /// @note This function can be called concurrently from multiple threads.
+    virtual auto respond(const ocsp_query& query) -> std::vector<byte> = 0;
+};
+//------------------------------------------------------------------------------
+/// @brief OCSP responder stand-in serving pre-fetched responses from files.
+///
+/// The response for a certificate is read from a file named by the serial
+/// number in lowercase hexadecimal with the .der extension.
+export class ocsp_file_responder final : public ocsp_responder {
+public:
+    ocsp_file_responder(std::filesystem::path directory) noexcept
+      : _directory{std::move(directory)} {}
+
+    auto respond(const ocsp_query& query) -> std::vector<byte> final {
+        std::ifstream file{
+          _directory / (std::string{query.serial} + ".der"), std::ios::binary};
+        return {std::istreambuf_iterator<char>{file}, {}};
+    }
+
+private:
+    std::filesystem::path _directory;
+};
+//------------------------------------------------------------------------------
+/// @brief In-process OCSP responder stand-in signing responses on demand.
+///
+/// The responses are signed by the specified signer, typically the issuing
+/// CA, and report the configured status of each serial number.
+export class ocsp_local_responder final : public ocsp_responder {
+public:
+    ocsp_local_responder(
+      const x509 signer,
+      const pkey signer_key,
+      const std::chrono::seconds validity = std::chrono::hours{1},
+      const ocsp_cert_status default_status = ocsp_cert_status::good) noexcept
+      : _signer{signer}
+      , _signer_key{signer_key}
+      , _validity{validity}
+      , _default_status{default_status} {}
+
+    /// @brief Sets the status reported for the specified hexadecimal serial.
+    void set_status(
+      const string_view serial,
+      const ocsp_cert_status status,
+      const int reason = -1,
+      const std::chrono::system_clock::time_point revocation_time =
+        std::chrono::system_clock::now()) {
+        const std::unique_lock lock{_mutex};
+        _statuses.insert_or_assign(
+          std::string{serial},
+          ocsp_single_status{
+            .status = status,
+            .reason = reason,
+            .revocation_time = revocation_time});
+    }
+
+    /// @brief Returns the number of queries answered so far.
+    auto query_count() const noexcept -> span_size_t {
+        return _queries.load();
+    }
+
+    auto respond(const ocsp_query& query) -> std::vector<byte> final {
+        ++_queries;
+        const auto now{std::chrono::system_clock::now()};
+        ocsp_response_spec spec{
+          .cert_id = query.cert_id,
+          .signer = _signer,
+          .signer_key = _signer_key,
+          .status = _default_status,
+          .this_update = now,
+          .next_update = now + _validity};
+        {
+            const std::unique_lock lock{_mutex};
+            const auto pos{_statuses.find(query.serial)};
+            if(pos != _statuses.end()) {
+                spec.status = pos->second.status;
+                spec.reason = pos->second.reason;
+                spec.revocation_time = pos->second.revocation_time;
+            }
+        }
+        std::vector<byte> response;
+        make_ocsp_response(spec, response);
+        return response;
+    }
+
+private:
+    const x509 _signer;
+    const pkey _signer_key;
+    const std::chrono::seconds _validity;
+    const ocsp_cert_status _default_status;
+    std::atomic<span_size_t> _queries{0};
+    std::mutex _mutex;
+    std::map<std::string, ocsp_single_status, std::less<>> _statuses;
+};
+//------------------------------------------------------------------------------
+/// @brief Parameters of the OCSP response cache.
+/// @see basic_ocsp_cache
+export struct ocsp_cache_options {
+    /// @brief Responses are refreshed this long before their next update.
+    std::chrono::seconds refresh_margin{std::chrono::minutes{5}};
+    /// @brief Interval of retries after a failed refresh.
+    std::chrono::seconds retry_interval{std::chrono::seconds{30}};
+    /// @brief Tolerated clock difference to the responder.
+    std::chrono::seconds max_clock_skew{std::chrono::minutes{5}};
+    /// @brief Lifetime of responses without the next update time.
+    std::chrono::seconds default_validity{std::chrono::hours{1}};
+    /// @brief OCSP_* flags passed to the response verification.
+    unsigned long verify_flags{0UL};
+    /// @brief Add a nonce to the requests and require it in the responses.
+    bool use_nonce{false};
+    /// @brief Refresh the cached responses on a background thread.
+    bool background_refresh{true};
+};
+
+/// @brief Result of a revocation check through the OCSP response cache.
+/// @see basic_ocsp_cache
+export struct ocsp_check_result {
+    ocsp_cert_status status{ocsp_cert_status::unknown};
+    /// @brief The CRL reason code of a revocation, negative if not specified.
+    int reason{-1};
+    /// @brief Indicates that a valid verified response was available.
+    bool valid{false};
+    /// @brief Indicates that the response was served from the cache.
+    bool cached{false};
+
+    /// @brief Indicates that the certificate is known to be good.
+    explicit operator bool() const noexcept {
+        return valid and (status == ocsp_cert_status::good);
+    }
+};
+//------------------------------------------------------------------------------
+/// @brief Cache of verified OCSP responses keyed by the DER encoded CertID.
+/// @see ocsp_responder
+///
+/// The responses are verified against the trusted store and used until their
+/// next update time. Entries are refreshed shortly before they expire, on a
+/// background thread if enabled, so checks of cached certificates do not wait
+/// for the responder. The cache is thread-safe.
+export template <typename ApiTraits>
+class basic_ocsp_cache {
+public:
+    basic_ocsp_cache(
+      const basic_ssl_api<ApiTraits>& ssl,
+      ocsp_responder& responder,
+      const x509_store trusted,
+      const ocsp_cache_options& opts = {})
+      : _ssl{ssl}
+      , _responder{responder}
+      , _opts{opts} {
+        if(ok copy{_ssl.copy_x509_store(trusted)}) {
+            _store = std::move(copy.get());
+        }
+        if(_opts.background_refresh) {
+            _refresher = std::thread{[this] { _refresh_loop(); }};
+        }
+    }
+
+    basic_ocsp_cache(basic_ocsp_cache&&) = delete;
+    basic_ocsp_cache(const basic_ocsp_cache&) = delete;
+    auto operator=(basic_ocsp_cache&&) = delete;
+    auto operator=(const basic_ocsp_cache&) = delete;
+
+    ~basic_ocsp_cache() noexcept {
+        if(_refresher.joinable()) {
+            {
+                const std::unique_lock lock{_refresh_mutex};
+                _done = true;
+            }
+            _refresh_cv.notify_all();
+            _refresher.join();
+        }
+        for(auto& entry : _entries) {
+            _ssl.delete_ocsp_cert_id(std::move(entry.second.cert_id));
+        }
+        if(_store) {
+            _ssl.delete_x509_store(std::move(_store));
+        }
+    }
+
+    /// @brief Returns the number of cached responses.
+    auto size() const noexcept -> span_size_t {
+        const std::shared_lock lock{_entries_mutex};
+        return span_size(_entries.size());
+    }
+
+    /// @brief Checks the revocation status of cert issued by issuer.
+    auto check(const x509 cert, const x509 issuer) -> ocsp_check_result {
+        ocsp_check_result result{};
+        if(ok cert_id{_ssl.make_ocsp_cert_id(cert, issuer)}) {
+            const auto del_id{_ssl.delete_ocsp_cert_id.raii(cert_id)};
+
+            std::string key;
+            if(not encode_ocsp_cert_id(cert_id.get(), key)) {
+                return result;
+            }
+            const auto now{std::chrono::system_clock::now()};
+            {
+                const std::shared_lock lock{_entries_mutex};
+                const auto pos{_entries.find(key)};
+                if(
+                  (pos != _entries.end()) and
+                  (now < pos->second.expires + _opts.max_clock_skew)) {
+                    // only ever set to true under the shared lock
+                    std::atomic_ref<bool>{pos->second.read}.store(
+                      true, std::memory_order_relaxed);
+                    result.status = pos->second.status.status;
+                    result.reason = pos->second.status.reason;
+                    result.valid = true;
+                    result.cached = true;
+                    return result;
+                }
+            }
+            const auto serial{
+              ocsp_serial_hex(get_ocsp_cert_id_serial(cert_id.get()))};
+            if(const auto status{_fetch(cert_id.get(), serial)}) {
+                result.status = status->status;
+                result.reason = status->reason;
+                result.valid = true;
+                _store_entry(
+                  std::move(key), cert_id.get(), serial, *status, true);
+            }
+        }
+        return result;
+    }
+
+    /// @brief Checks all certificates in a verified chain except the trust anchor.
+    /// @see basic_chain_verifier::verify_chain
+    auto check_chain(const object_stack<owned_x509>& chain)
+      -> ocsp_check_result {
+        ocsp_check_result result{
+          .status = ocsp_cert_status::good, .valid = true, .cached = true};
+        for(int i = 0; i + 1 < chain.size(); ++i) {
+            const auto checked{check(chain.get(i), chain.get(i + 1))};
+            if(not checked) {
+                return checked;
+            }
+            result.cached = result.cached and checked.cached;
+        }
+        return result;
+    }
+
+    /// @brief Refreshes the due responses read since their last refresh.
+    /// @return The number of refreshed responses.
+    /// @note Called by the background thread if enabled.
+    auto refresh_due() -> span_size_t {
+        struct due_entry {
+            std::string key;
+            std::string serial;
+            owned_ocsp_cert_id cert_id;
+        };
+        const auto now{std::chrono::system_clock::now()};
+        _evict_stale(now);
+        std::vector<due_entry> due;
+        {
+            const std::shared_lock lock{_entries_mutex};
+            for(auto& [key, entry] : _entries) {
+                // entries not read since the last refresh are left to expire
+                // and are evicted then, instead of being refreshed forever
+                const bool was_read{std::atomic_ref<bool>{entry.read}.load(
+                  std::memory_order_relaxed)};
+                if(was_read and (entry.refresh_at <= now)) {
+                    if(ok copy{_ssl.copy_ocsp_cert_id(entry.cert_id)}) {
+                        due.push_back(
+                          {.key = key,
+                           .serial = entry.serial,
+                           .cert_id = std::move(copy.get())});
+                    }
+                }
+            }
+        }
+        span_size_t refreshed{0};
+        for(auto& entry : due) {
+            if(const auto status{_fetch(entry.cert_id, entry.serial)}) {
+                _store_entry(
+                  std::move(entry.key),
+                  entry.cert_id,
+                  entry.serial,
+                  *status,
+                  false);
+                ++refreshed;
+            } else {
+                _postpone(entry.key, now + _opts.retry_interval);
+            }
+            _ssl.delete_ocsp_cert_id(std::move(entry.cert_id));
+        }
+        return refreshed;
+    }
+
+private:
+    using _clock = std::chrono::system_clock;
+
+    struct _entry {
+        owned_ocsp_cert_id cert_id;
+        std::string serial;
+        ocsp_single_status status;
+        _clock::time_point expires;
+        _clock::time_point refresh_at;
+        // indicates if the entry was used since the last refresh
+        bool read{true};
+    };
+
+    auto _fetch(const ocsp_cert_id cert_id, const string_view serial)
+      -> std::optional<ocsp_single_status> {
+        std::optional<ocsp_single_status> result;
+        if(ok request{_ssl.new_ocsp_request()}) {
+            const auto del_req{_ssl.delete_ocsp_request.raii(request)};
+
+            if(ok req_id{_ssl.copy_ocsp_cert_id(cert_id)}) {
+                if(not _ssl.add_into_ocsp_request(
+                     request, std::move(req_id.get()))) {
+                    return result;
+                }
+            } else {
+                return result;
+            }
+            if(_opts.use_nonce) {
+                _ssl.add_nonce_into_ocsp_request(request);
+            }
+            std::vector<byte> request_der;
+            if(not encode_ocsp_request(request.get(), request_der)) {
+                return result;
+            }
+
+            const auto response_der{_responder.respond(
+              {.cert_id = cert_id,
+               .request = view(request_der),
+               .serial = serial})};
+            if(auto response{parse_ocsp_response(view(response_der))}) {
+                if(
+                  _ssl.get_ocsp_response_status(response).value_or(-1) ==
+                  _ssl.ocsp_response_status_successful) {
+                    if(ok basic{_ssl.get_ocsp_basic_response(response)}) {
+                        const auto del_basic{
+                          _ssl.delete_ocsp_basic_response.raii(basic)};
+
+                        if(
+                          _ssl.ocsp_verify_basic_response(
+                            basic, _no_certs, _store, _opts.verify_flags) and
+                          (not _opts.use_nonce or
+                           _ssl.check_ocsp_nonce(request, basic).value_or(0) >
+                             0)) {
+                            result = find_ocsp_status(basic.get(), cert_id);
+                        }
+                    }
+                }
+                _ssl.delete_ocsp_response(std::move(response));
+            }
+        }
+        if(result and not _is_current(*result)) {
+            result.reset();
+        }
+        return result;
+    }
+
+    auto _is_current(const ocsp_single_status& status) const noexcept -> bool {
+        const auto now{_clock::now()};
+        if(status.this_update > now + _opts.max_clock_skew) {
+            return false;
+        }
+        return not status.next_update or
+               (*status.next_update + _opts.max_clock_skew > now);
+    }
+
+    void _store_entry(
+      std::string key,
+      const ocsp_cert_id cert_id,
+      const string_view serial,
+      const ocsp_single_status& status,
+      const bool read) {
+        const auto expires{status.next_update.value_or(
+          status.this_update + _opts.default_validity)};
+        const auto refresh_at{expires - _opts.refresh_margin};
+        {
+            const std::unique_lock lock{_entries_mutex};
+            auto pos{_entries.find(key)};
+            if(pos != _entries.end()) {
+                pos->second.status = status;
+                pos->second.expires = expires;
+                pos->second.refresh_at = refresh_at;
+                pos->second.read = read;
+            } else if(ok copy{_ssl.copy_ocsp_cert_id(cert_id)}) {
+                _entries.emplace(
+                  std::move(key),
+                  _entry{
+                    .cert_id = std::move(copy.get()),
+                    .serial = std::string{serial},
+                    .status = status,
+                    .expires = expires,
+                    .refresh_at = refresh_at,
+                    .read = read});
+            }
+        }
+        _refresh_cv.notify_all();
+    }
+
+    void _postpone(const std::string& key, const _clock::time_point when) {
+        const std::unique_lock lock{_entries_mutex};
+        auto pos{_entries.find(key)};
+        if(pos != _entries.end()) {
+            // retry later even if the response already expired
+            pos->second.refresh_at = std::max(when, pos->second.refresh_at);
+            pos->second.read = false;
+        }
+    }
+
+    void _evict_stale(const _clock::time_point now) {
+        const std::unique_lock lock{_entries_mutex};
+        std::erase_if(_entries, [&](auto& entry) {
+            if(
+              not entry.second.read and
+              (entry.second.expires + _opts.max_clock_skew < now)) {
+                _ssl.delete_ocsp_cert_id(std::move(entry.second.cert_id));
+                return true;
+            }
+            return false;
+        });
+    }
+
+    auto _next_refresh() const noexcept -> _clock::time_point {
+        auto result{_clock::now() + std::chrono::minutes{1}};
+        const std::shared_lock lock{_entries_mutex};
+        for(const auto& entry : _entries) {
+            result = std::min(result, entry.second.refresh_at);
+        }
+        return result;
+    }
+
+    void _refresh_loop() noexcept {
+        std::unique_lock lock{_refresh_mutex};
+        while(not _done) {
+            _refresh_cv.wait_until(lock, _next_refresh());
+            if(_done) {
+                break;
+            }
+            lock.unlock();
+            try {
+                refresh_due();
+            } catch(...) {
+            }
+            lock.lock();
+        }
+    }
+
+    const basic_ssl_api<ApiTraits>& _ssl;
+    ocsp_responder& _responder;
+    const ocsp_cache_options _opts;
+    owned_x509_store _store{};
+    const object_stack<x509> _no_certs;
+    mutable std::shared_mutex _entries_mutex;
+    std::unordered_map<std::string, _entry> _entries;
+    std::mutex _refresh_mutex;
+    std::condition_variable _refresh_cv;
+    bool _done{false};
+    std::thread _refresher;
+};
+//------------------------------------------------------------------------------
+export using ocsp_cache = basic_ocsp_cache<ssl_api_traits>;
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
@@ -0,0 +1,190 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+module;
+
+#if __has_include(<openssl/ocsp.h>)
+#include <openssl/asn1.h>
+#include <openssl/evp.h>
+#include <openssl/ocsp.h>
+
+#define EAGINE_HAS_SSL 1
+#else
+#define EAGINE_HAS_SSL 0
+#endif
+
+module eagine.sslplus;
+
+import std;
+import eagine.core.memory;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+#if EAGINE_HAS_SSL
+static auto to_time_point(const ASN1_TIME* value) noexcept
+  -> std::chrono::system_clock::time_point {
+    return as_time_point(asn1_string{value}).value_or(
+      std::chrono::system_clock::time_point{});
+}
+
+static auto from_time_point(const std::chrono::system_clock::time_point tp)
+  -> ASN1_TIME* {
+    return ASN1_TIME_set(nullptr, std::chrono::system_clock::to_time_t(tp));
+}
+
+template <typename T, typename Container>
+static auto encode_der(
+  int (*i2d)(const T*, unsigned char**),
+  const T* obj,
+  Container& dst) -> bool {
+    if(obj) {
+        const auto size{i2d(obj, nullptr)};
+        if(size > 0) {
+            dst.resize(std_size(size));
+            auto* pos{reinterpret_cast<unsigned char*>(dst.data())};
+            return i2d(obj, &pos) == size;
+        }
+    }
+    dst.clear();
+    return false;
+}
+#endif
+//------------------------------------------------------------------------------
+auto find_ocsp_status(
+  [[maybe_unused]] const ocsp_basic_response basic,
+  [[maybe_unused]] const ocsp_cert_id cert_id) noexcept
+  -> std::optional<ocsp_single_status> {
+#if EAGINE_HAS_SSL
+    int status{-1};
+    int reason{-1};
+    ASN1_GENERALIZEDTIME* revocation_time{nullptr};
+    ASN1_GENERALIZEDTIME* this_update{nullptr};
+    ASN1_GENERALIZEDTIME* next_update{nullptr};
+    if(
+      basic and cert_id and
+      OCSP_resp_find_status(
+        static_cast<OCSP_BASICRESP*>(basic),
+        static_cast<OCSP_CERTID*>(cert_id),
+        &status,
+        &reason,
+        &revocation_time,
+        &this_update,
+        &next_update)) {
+        ocsp_single_status result{
+          .status = static_cast<ocsp_cert_status>(status),
+          .reason = reason,
+          .revocation_time = to_time_point(revocation_time),
+          .this_update = to_time_point(this_update)};
+        if(next_update) {
+            result.next_update = to_time_point(next_update);
+        }
+        return result;
+    }
+#endif
+    return {};
+}
+//------------------------------------------------------------------------------
+auto encode_ocsp_request(
+  [[maybe_unused]] const ocsp_request request,
+  [[maybe_unused]] std::vector<byte>& dst) -> bool {
+#if EAGINE_HAS_SSL
+    return encode_der<OCSP_REQUEST>(
+      &i2d_OCSP_REQUEST, static_cast<OCSP_REQUEST*>(request), dst);
+#else
+    return false;
+#endif
+}
+//------------------------------------------------------------------------------
+auto encode_ocsp_cert_id(
+  [[maybe_unused]] const ocsp_cert_id cert_id,
+  [[maybe_unused]] std::string& dst) -> bool {
+#if EAGINE_HAS_SSL
+    return encode_der<OCSP_CERTID>(
+      &i2d_OCSP_CERTID, static_cast<OCSP_CERTID*>(cert_id), dst);
+#else
+    return false;
+#endif
+}
+//------------------------------------------------------------------------------
+auto get_ocsp_cert_id_serial([[maybe_unused]] const ocsp_cert_id cert_id) noexcept
+  -> memory::const_block {
+#if EAGINE_HAS_SSL
+    ASN1_INTEGER* serial{nullptr};
+    if(
+      cert_id and OCSP_id_get0_info(
+                    nullptr,
+                    nullptr,
+                    nullptr,
+                    &serial,
+                    static_cast<OCSP_CERTID*>(cert_id)) and
+      serial) {
+        return {
+          ASN1_STRING_get0_data(serial), span_size(ASN1_STRING_length(serial))};
+    }
+#endif
+    return {};
+}
+//------------------------------------------------------------------------------
+auto parse_ocsp_response([[maybe_unused]] const memory::const_block der) noexcept
+  -> owned_ocsp_response {
+#if EAGINE_HAS_SSL
+    if(not der.empty()) {
+        const auto* pos{reinterpret_cast<const unsigned char*>(der.data())};
+        if(auto* response{d2i_OCSP_RESPONSE(
+             nullptr, &pos, static_cast<long>(der.size()))}) {
+            return owned_ocsp_response{response};
+        }
+    }
+#endif
+    return {};
+}
+//------------------------------------------------------------------------------
+auto make_ocsp_response(
+  [[maybe_unused]] const ocsp_response_spec& spec,
+  [[maybe_unused]] std::vector<byte>& dst) -> bool {
+    bool result{false};
+#if EAGINE_HAS_SSL
+    if(auto* basic{OCSP_BASICRESP_new()}) {
+        const bool revoked{spec.status == ocsp_cert_status::revoked};
+        ASN1_TIME* revocation_time{
+          revoked ? from_time_point(spec.revocation_time) : nullptr};
+        ASN1_TIME* this_update{from_time_point(spec.this_update)};
+        ASN1_TIME* next_update{from_time_point(spec.next_update)};
+
+        if(
+          OCSP_basic_add1_status(
+            basic,
+            static_cast<OCSP_CERTID*>(spec.cert_id),
+            static_cast<int>(spec.status),
+            revoked ? spec.reason : -1,
+            revocation_time,
+            this_update,
+            next_update) and
+          OCSP_basic_sign(
+            basic,
+            static_cast<X509*>(spec.signer),
+            static_cast<EVP_PKEY*>(spec.signer_key),
+            EVP_sha256(),
+            nullptr,
+            0UL)) {
+            if(auto* response{OCSP_response_create(
+                 OCSP_RESPONSE_STATUS_SUCCESSFUL, basic)}) {
+                result = encode_der<OCSP_RESPONSE>(
+                  &i2d_OCSP_RESPONSE, response, dst);
+                OCSP_RESPONSE_free(response);
+            }
+        }
+        ASN1_TIME_free(next_update);
+        ASN1_TIME_free(this_update);
+        ASN1_TIME_free(revocation_time);
+        OCSP_BASICRESP_free(basic);
+    }
+#endif
+    return result;
+}
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
@@ -0,0 +1,135 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+export module eagine.sslplus:pinning;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+import eagine.core.utility;
+import :api_traits;
+import :object_handle;
+import :api;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+/// @brief Writes the DER encoding of the certificate SubjectPublicKeyInfo.
+/// @return The head of dst containing the encoding or an empty block.
+export auto encode_x509_spki(const x509 cert, memory::block dst) noexcept
+  -> memory::block;
+
+/// @brief SHA-256 hash of a DER encoded SubjectPublicKeyInfo (RFC 7469 pin).
+export using spki_sha256 = std::array<byte, 32>;
+
+struct spki_sha256_hash {
+    auto operator()(const spki_sha256& pin) const noexcept -> std::size_t {
+        // the bytes of the digest are already uniformly distributed
+        std::size_t result{0U};
+        std::memcpy(&result, pin.data(), sizeof(result));
+        return result;
+    }
+};
+//------------------------------------------------------------------------------
+/// @brief Set of pinned SubjectPublicKeyInfo SHA-256 hashes.
+///
+/// Lookups take constant time regardless of the number of pins, so that
+/// the set can be checked for each certificate in the chain, for example
+/// from a verification callback. The set should be populated before it is
+/// shared, concurrent lookups are then thread-safe.
+export template <typename ApiTraits>
+class basic_spki_pin_set {
+public:
+    basic_spki_pin_set(const basic_ssl_api<ApiTraits>& ssl) noexcept
+      : _ssl{ssl} {
+        if(ok md{_ssl.message_digest_sha256()}) {
+            _sha256 = md.get();
+        }
+    }
+
+    /// @brief Computes the SPKI pin of the specified certificate.
+    auto pin_of(const x509 cert) const noexcept -> std::optional<spki_sha256> {
+        std::array<byte, 2048> der{};
+        if(const auto spki{encode_x509_spki(cert, cover(der))}) {
+            spki_sha256 pin{};
+            if(not _ssl.data_digest(spki, cover(pin), _sha256).empty()) {
+                return {pin};
+            }
+        }
+        return {};
+    }
+
+    /// @brief Pre-allocates space for the specified number of pins.
+    void reserve(const span_size_t count) {
+        _pins.reserve(std_size(count));
+    }
+
+    /// @brief Adds the specified pin.
+    /// @return Indicates if the pin was not in this set yet.
+    auto add(const spki_sha256& pin) -> bool {
+        return _pins.insert(pin).second;
+    }
+
+    /// @brief Adds the pin from raw digest bytes.
+    /// @return Indicates if the block had the size of a SHA-256 digest.
+    auto add(const memory::const_block digest) -> bool {
+        spki_sha256 pin{};
+        if(digest.size() == span_size(pin.size())) {
+            std::copy(digest.begin(), digest.end(), pin.begin());
+            _pins.insert(pin);
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief Adds the pin of the specified certificate.
+    auto add(const x509 cert) -> bool {
+        if(const auto pin{pin_of(cert)}) {
+            _pins.insert(*pin);
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief Returns the number of pins.
+    auto size() const noexcept -> span_size_t {
+        return span_size(_pins.size());
+    }
+
+    /// @brief Indicates if there are no pins.
+    auto empty() const noexcept -> bool {
+        return _pins.empty();
+    }
+
+    /// @brief Indicates if the specified pin is in this set.
+    auto contains(const spki_sha256& pin) const noexcept -> bool {
+        return _pins.contains(pin);
+    }
+
+    /// @brief Indicates if the pin of the specified certificate is in this set.
+    auto matches(const x509 cert) const noexcept -> bool {
+        if(const auto pin{pin_of(cert)}) {
+            return contains(*pin);
+        }
+        return false;
+    }
+
+    /// @brief Indicates if any certificate in a range (chain) is pinned.
+    template <typename Range>
+    auto matches_any(const Range& certs) const noexcept -> bool {
+        return std::ranges::any_of(
+          certs, [this](const x509 cert) { return matches(cert); });
+    }
+
+private:
+    const basic_ssl_api<ApiTraits>& _ssl;
+    message_digest_type _sha256{};
+    std::unordered_set<spki_sha256, spki_sha256_hash> _pins;
+};
+//------------------------------------------------------------------------------
+export using spki_pin_set = basic_spki_pin_set<ssl_api_traits>;
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
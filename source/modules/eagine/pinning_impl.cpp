@@ -0,0 +1,44 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+module;
+
+#if __has_include(<openssl/x509.h>)
+#include <openssl/x509.h>
+
+#define EAGINE_HAS_SSL 1
+#else
+#define EAGINE_HAS_SSL 0
+#endif
+
+module eagine.sslplus;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+auto encode_x509_spki(
+  [[maybe_unused]] const x509 cert,
+  [[maybe_unused]] memory::block dst) noexcept -> memory::block {
+#if EAGINE_HAS_SSL
+    if(cert) {
+        if(auto* spki{X509_get_X509_PUBKEY(static_cast<X509*>(cert))}) {
+            const auto size{i2d_X509_PUBKEY(spki, nullptr)};
+            if((size > 0) and (span_size(size) <= dst.size())) {
+                auto* out{dst.data()};
+                i2d_X509_PUBKEY(spki, &out);
+                return head(dst, span_size(size));
+            }
+        }
+    }
+#endif
+    return {};
+}
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
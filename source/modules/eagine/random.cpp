@@ -0,0 +1,387 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+export module eagine.sslplus:random;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+import eagine.core.utility;
+import :api_traits;
+import :object_handle;
+import :api;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+/// @brief Returns a counter incremented in child processes after each fork.
+/// @see random_byte_pool
+export auto random_fork_generation() noexcept -> std::uint64_t;
+
+// wipes the bytes with OPENSSL_cleanse, which is not optimized away
+void cleanse_random_bytes(memory::block blk) noexcept;
+//------------------------------------------------------------------------------
+/// @brief Options of a buffered random byte pool.
+/// @see random_byte_pool
+export struct random_byte_pool_options {
+    /// @brief The size of the buffer refilled from the DRBG.
+    span_size_t capacity{16 * 1024};
+    /// @brief Library context used with the extended RAND functions.
+    lib_ctx libctx{};
+    /// @brief Use the private DRBG instead of the public one.
+    bool use_private{false};
+};
+//------------------------------------------------------------------------------
+/// @brief Serves small random byte requests from a buffer refilled in bulk.
+/// @see pooled_random_bytes
+///
+/// Requests larger than a quarter of the buffer are passed through directly.
+/// The consumed bytes are wiped immediately and the unused remainder is
+/// discarded in child processes after a fork. Instances are not thread-safe.
+export class random_byte_pool {
+public:
+    random_byte_pool() noexcept = default;
+    random_byte_pool(const random_byte_pool_options& opts) noexcept
+      : _opts{opts} {}
+
+    random_byte_pool(random_byte_pool&&) = delete;
+    random_byte_pool(const random_byte_pool&) = delete;
+    auto operator=(random_byte_pool&&) = delete;
+    auto operator=(const random_byte_pool&) = delete;
+
+    ~random_byte_pool() noexcept {
+        cleanse_random_bytes(skip(cover(_buffer), _offset));
+    }
+
+    /// @brief Returns the number of buffered bytes ready to be served.
+    auto available() const noexcept -> span_size_t {
+        return span_size(_buffer.size()) - _offset;
+    }
+
+    /// @brief Fills dst with random bytes.
+    template <typename ApiTraits>
+    auto fill(const basic_ssl_api<ApiTraits>& ssl, memory::block dst) noexcept
+      -> bool {
+        if(dst.size() * 4 > _opts.capacity) {
+            return _generate(ssl, dst);
+        }
+        if(const auto generation{random_fork_generation()};
+           _generation != generation) {
+            _discard();
+            _generation = generation;
+        }
+        while(not dst.empty()) {
+            if(available() == 0) {
+                if(not _refill(ssl)) {
+                    return false;
+                }
+            }
+            const auto src{head(
+              skip(cover(_buffer), _offset), std::min(dst.size(), available()))};
+            std::copy(src.begin(), src.end(), dst.begin());
+            ssl.cleanse_memory(src);
+            _offset += src.size();
+            dst = skip(dst, src.size());
+        }
+        return true;
+    }
+
+private:
+    template <typename ApiTraits>
+    auto _generate(const basic_ssl_api<ApiTraits>& ssl, memory::block dst)
+      const noexcept -> bool {
+        if(_opts.use_private) {
+            if(_opts.libctx) {
+                return bool(ssl.random_private_bytes_ex(_opts.libctx, dst, 0U));
+            }
+            return bool(ssl.random_private_bytes(dst));
+        }
+        if(_opts.libctx) {
+            return bool(ssl.random_bytes_ex(_opts.libctx, dst, 0U));
+        }
+        return bool(ssl.random_bytes(dst));
+    }
+
+    template <typename ApiTraits>
+    auto _refill(const basic_ssl_api<ApiTraits>& ssl) noexcept -> bool {
+        if(_buffer.empty()) {
+            // allocated on first use, a failure is reported like a DRBG error
+            try {
+                _buffer.resize(std_size(_opts.capacity));
+            } catch(...) {
+                return false;
+            }
+        }
+        if(_generate(ssl, cover(_buffer))) {
+            _offset = 0;
+            return true;
+        }
+        _discard();
+        return false;
+    }
+
+    void _discard() noexcept {
+        cleanse_random_bytes(skip(cover(_buffer), _offset));
+        _offset = span_size(_buffer.size());
+    }
+
+    random_byte_pool_options _opts{};
+    std::vector<byte> _buffer;
+    span_size_t _offset{0};
+    std::uint64_t _generation{0U};
+};
+//------------------------------------------------------------------------------
+/// @brief Fills dst with random bytes from a thread-local random_byte_pool.
+/// @see basic_ssl_api::random_bytes
+export template <typename ApiTraits>
+auto pooled_random_bytes(
+  const basic_ssl_api<ApiTraits>& ssl,
+  memory::block dst) noexcept -> bool {
+    thread_local random_byte_pool pool;
+    return pool.fill(ssl, dst);
+}
+//------------------------------------------------------------------------------
+/// @brief Textual representation of a UUID (without terminating zero).
+/// @see basic_random_generator::fill_uuids
+export using uuid_string = std::array<char, 36>;
+//------------------------------------------------------------------------------
+template <typename T>
+constexpr const bool is_bool_or_char_v =
+  std::same_as<std::remove_cv_t<T>, bool> or
+  std::same_as<std::remove_cv_t<T>, char> or
+  std::same_as<std::remove_cv_t<T>, wchar_t> or
+  std::same_as<std::remove_cv_t<T>, char8_t> or
+  std::same_as<std::remove_cv_t<T>, char16_t> or
+  std::same_as<std::remove_cv_t<T>, char32_t>;
+//------------------------------------------------------------------------------
+/// @brief Random bit generator backed by the buffered OpenSSL DRBG.
+/// @see pooled_random_bytes
+///
+/// Satisfies the std::uniform_random_bit_generator concept and provides
+/// unbiased integers in a range and batched formatting of random UUIDs and
+/// URL-safe tokens, drawing the randomness for a whole batch at once.
+/// Instances are not thread-safe, use one generator per thread.
+export template <typename ApiTraits>
+class basic_random_generator {
+public:
+    using result_type = std::uint64_t;
+
+    basic_random_generator(const basic_ssl_api<ApiTraits>& ssl) noexcept
+      : _ssl{ssl} {}
+
+    basic_random_generator(basic_random_generator&&) = delete;
+    basic_random_generator(const basic_random_generator&) = delete;
+    auto operator=(basic_random_generator&&) = delete;
+    auto operator=(const basic_random_generator&) = delete;
+
+    ~basic_random_generator() noexcept {
+        _ssl.cleanse_memory(_value_bytes());
+    }
+
+    static constexpr auto min() noexcept -> result_type {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    static constexpr auto max() noexcept -> result_type {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    /// @brief Returns the next random 64-bit value.
+    /// @throws std::runtime_error if the DRBG fails.
+    auto operator()() -> result_type {
+        if(_index == _values.size()) {
+            _fill(_value_bytes());
+            _index = 0;
+        }
+        return std::exchange(_values[_index++], result_type{0U});
+    }
+
+    /// @brief Returns a uniformly distributed integer in the range [lo, hi].
+    /// @pre lo <= hi
+    template <std::integral T>
+        requires(not is_bool_or_char_v<T>)
+    auto uniform_int(const T lo, const T hi) -> T {
+        using U = std::make_unsigned_t<T>;
+        // narrow types are promoted to int by the subtraction
+        const auto range{std::uint64_t(U(U(hi) - U(lo))) + 1U};
+        return T(U(lo) + U(_below(range)));
+    }
+
+    /// @brief Fills dst with random UUIDv4 strings drawn from a single fill.
+    void fill_uuids(const std::span<uuid_string> dst) {
+        static constexpr const std::size_t batch{64U};
+        std::array<byte, batch * 16U> bytes{};
+        for(std::size_t b = 0; b < dst.size(); b += batch) {
+            const auto count{std::min(batch, dst.size() - b)};
+            const auto rand{head(cover(bytes), span_size(count * 16U))};
+            _fill(rand);
+            for(std::size_t i = 0; i < count; ++i) {
+                _format_uuid(skip(rand, span_size(i * 16U)), dst[b + i]);
+            }
+            _ssl.cleanse_memory(rand);
+        }
+    }
+
+    /// @brief Returns the specified number of random UUIDv4 strings.
+    auto make_uuids(const span_size_t count) -> std::vector<std::string> {
+        std::vector<uuid_string> uuids(std_size(count));
+        fill_uuids(uuids);
+        std::vector<std::string> result;
+        result.reserve(uuids.size());
+        for(const auto& uuid : uuids) {
+            result.emplace_back(uuid.data(), uuid.size());
+        }
+        return result;
+    }
+
+    /// @brief Returns a random UUIDv4 string.
+    auto make_uuid() -> std::string {
+        uuid_string uuid{};
+        fill_uuids({&uuid, 1U});
+        return {uuid.data(), uuid.size()};
+    }
+
+    /// @brief Returns the length of a token encoding the specified byte count.
+    static constexpr auto token_length(const span_size_t token_bytes) noexcept
+      -> span_size_t {
+        return (token_bytes * 4 + 2) / 3;
+    }
+
+    /// @brief Returns URL-safe tokens, each encoding token_bytes random bytes.
+    /// @note The tokens use the unpadded base64url alphabet.
+    auto make_tokens(const span_size_t count, const span_size_t token_bytes)
+      -> std::vector<std::string> {
+        if(token_bytes <= 0) {
+            return std::vector<std::string>(std_size(count));
+        }
+        std::vector<std::string> result;
+        result.reserve(std_size(count));
+        std::array<byte, 4096> bytes{};
+        const auto per_batch{
+          std::max<std::size_t>(bytes.size() / std_size(token_bytes), 1U)};
+        std::vector<byte> large;
+        if(per_batch * std_size(token_bytes) > bytes.size()) {
+            large.resize(std_size(token_bytes));
+        }
+        for(span_size_t t = 0; t < count;) {
+            const auto batch{std::min(span_size(per_batch), count - t)};
+            const auto rand{
+              large.empty() ? head(cover(bytes), batch * token_bytes)
+                            : cover(large)};
+            _fill(rand);
+            for(span_size_t i = 0; i < batch; ++i) {
+                result.push_back(
+                  _encode_token(head(skip(rand, i * token_bytes), token_bytes)));
+            }
+            _ssl.cleanse_memory(rand);
+            t += batch;
+        }
+        return result;
+    }
+
+    /// @brief Returns an URL-safe token encoding token_bytes random bytes.
+    auto make_token(const span_size_t token_bytes) -> std::string {
+        return std::move(make_tokens(1, token_bytes).front());
+    }
+
+private:
+    auto _value_bytes() noexcept -> memory::block {
+        return {
+          reinterpret_cast<byte*>(_values.data()), span_size(sizeof(_values))};
+    }
+
+    void _fill(memory::block dst) {
+        if(not pooled_random_bytes(_ssl, dst)) {
+            throw std::runtime_error("failed to generate random bytes");
+        }
+    }
+
+    // returns the high and the low half of the 128-bit product
+    static constexpr auto _multiply(
+      const std::uint64_t a,
+      const std::uint64_t b) noexcept
+      -> std::pair<std::uint64_t, std::uint64_t> {
+#ifdef __SIZEOF_INT128__
+        const auto m{static_cast<unsigned __int128>(a) * b};
+        return {
+          static_cast<std::uint64_t>(m >> 64U), static_cast<std::uint64_t>(m)};
+#else
+        const std::uint64_t mask{0xFFFFFFFFU};
+        const auto lo_lo{(a & mask) * (b & mask)};
+        const auto hi_lo{(a >> 32U) * (b & mask)};
+        const auto lo_hi{(a & mask) * (b >> 32U)};
+        const auto hi_hi{(a >> 32U) * (b >> 32U)};
+        const auto cross{(lo_lo >> 32U) + (hi_lo & mask) + lo_hi};
+        return {
+          hi_hi + (hi_lo >> 32U) + (cross >> 32U),
+          (cross << 32U) | (lo_lo & mask)};
+#endif
+    }
+
+    // Lemire's nearly divisionless method, zero range means the full range
+    auto _below(const std::uint64_t range) -> std::uint64_t {
+        if(range == 0U) {
+            return (*this)();
+        }
+        auto [high, low] = _multiply((*this)(), range);
+        if(low < range) {
+            const std::uint64_t threshold{(0U - range) % range};
+            while(low < threshold) {
+                std::tie(high, low) = _multiply((*this)(), range);
+            }
+        }
+        return high;
+    }
+
+    static void _format_uuid(
+      const memory::const_block rand,
+      uuid_string& dst) noexcept {
+        static constexpr const char hex[] = "0123456789abcdef";
+        std::size_t o{0U};
+        for(span_size_t i = 0; i < 16; ++i) {
+            if(i == 4 or i == 6 or i == 8 or i == 10) {
+                dst[o++] = '-';
+            }
+            auto b{unsigned(rand[i])};
+            if(i == 6) {
+                b = (b & 0x0FU) | 0x40U;
+            } else if(i == 8) {
+                b = (b & 0x3FU) | 0x80U;
+            }
+            dst[o++] = hex[b >> 4U];
+            dst[o++] = hex[b & 0x0FU];
+        }
+    }
+
+    static auto _encode_token(const memory::const_block rand) -> std::string {
+        static constexpr const char alphabet[] =
+          "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+        std::string result;
+        result.reserve(std_size(token_length(rand.size())));
+        std::uint32_t acc{0U};
+        unsigned bits{0U};
+        for(const auto b : rand) {
+            acc = (acc << 8U) | std::uint32_t(b);
+            bits += 8U;
+            while(bits >= 6U) {
+                bits -= 6U;
+                result.push_back(alphabet[(acc >> bits) & 0x3FU]);
+            }
+        }
+        if(bits > 0U) {
+            result.push_back(alphabet[(acc << (6U - bits)) & 0x3FU]);
+        }
+        return result;
+    }
+
+    const basic_ssl_api<ApiTraits>& _ssl;
+    std::array<result_type, 32> _values{};
+    std::size_t _index{_values.size()};
+};
+//------------------------------------------------------------------------------
+export using random_generator = basic_random_generator<ssl_api_traits>;
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
@@ -0,0 +1,59 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+module;
+
+#if __has_include(<openssl/crypto.h>)
+#include <openssl/crypto.h>
+
+#define EAGINE_HAS_SSL 1
+#else
+#define EAGINE_HAS_SSL 0
+#endif
+
+#if __has_include(<pthread.h>)
+#include <pthread.h>
+
+#define EAGINE_HAS_PTHREAD_ATFORK 1
+#else
+#define EAGINE_HAS_PTHREAD_ATFORK 0
+#endif
+
+module eagine.sslplus;
+
+import std;
+import eagine.core.memory;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+static std::atomic<std::uint64_t> fork_generation{0U};
+//------------------------------------------------------------------------------
+#if EAGINE_HAS_PTHREAD_ATFORK
+static void random_atfork_child() noexcept {
+    fork_generation.fetch_add(1U, std::memory_order_relaxed);
+}
+#endif
+//------------------------------------------------------------------------------
+auto random_fork_generation() noexcept -> std::uint64_t {
+#if EAGINE_HAS_PTHREAD_ATFORK
+    [[maybe_unused]] static const int registered{::pthread_atfork(
+      nullptr, nullptr, &random_atfork_child)};
+#endif
+    return fork_generation.load(std::memory_order_relaxed);
+}
+//------------------------------------------------------------------------------
+void cleanse_random_bytes(memory::block blk) noexcept {
+#if EAGINE_HAS_SSL
+    if(not blk.empty()) {
+        OPENSSL_cleanse(blk.data(), std_size(blk.size()));
+    }
+#else
+    std::fill(blk.begin(), blk.end(), byte{0});
+#endif
+}
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
@@ -0,0 +1,232 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+export module eagine.sslplus:secure_memory;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+import eagine.core.utility;
+import :api;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+/// @brief Statistics of the secure_arena.
+export struct secure_arena_stats {
+    /// @brief Number of allocations served from the pools.
+    std::size_t pool_hits{0U};
+    /// @brief Number of allocations from the OpenSSL secure heap.
+    std::size_t heap_allocations{0U};
+    /// @brief Number of released chunks kept in the pools.
+    std::size_t pooled{0U};
+    /// @brief Number of bytes allocated from the secure heap.
+    std::size_t secure_heap_used{0U};
+};
+//------------------------------------------------------------------------------
+/// @brief Allocator of zero-initialized memory for keys, passwords and secrets.
+/// @see basic_ssl_api::init_secure_heap
+/// @see secure_block
+///
+/// The memory comes from the OpenSSL secure heap, a region of locked pages
+/// which are excluded from swapping and core dumps, mapped and locked once
+/// by init_secure_heap instead of on each allocation. Small blocks are
+/// rounded up to size classes and released chunks are pooled, so that they
+/// can be reused without going through the secure heap allocator. Every
+/// released block is wiped, including the pooled ones. If the secure heap
+/// is not initialized, the memory comes from the regular heap.
+export class secure_arena {
+public:
+    /// @brief Returns the process-wide arena.
+    static auto instance() noexcept -> secure_arena&;
+
+    secure_arena(secure_arena&&) = delete;
+    secure_arena(const secure_arena&) = delete;
+    auto operator=(secure_arena&&) = delete;
+    auto operator=(const secure_arena&) = delete;
+
+    /// @brief Allocates a zero-initialized block of the specified size.
+    /// @return The allocated block or an empty block on failure.
+    auto allocate(const span_size_t size) noexcept -> memory::block;
+
+    /// @brief Wipes and releases a block returned by allocate.
+    /// @note The block must have the originally requested size.
+    void deallocate(memory::block blk) noexcept;
+
+    /// @brief Indicates if the block is allocated in the secure heap.
+    auto is_secure(const memory::const_block blk) const noexcept -> bool;
+
+    /// @brief Returns all pooled chunks to the secure heap.
+    void trim() noexcept;
+
+    /// @brief Returns the current statistics.
+    auto stats() const noexcept -> secure_arena_stats;
+
+private:
+    secure_arena() noexcept = default;
+    ~secure_arena() noexcept = default;
+
+    static constexpr const std::size_t _class_count{6U};
+    static constexpr const std::array<std::size_t, _class_count> _class_sizes{
+      {16U, 32U, 64U, 128U, 256U, 512U}};
+    static constexpr const std::size_t _max_pooled{64U};
+
+    static auto _class_of(const std::size_t size) noexcept -> std::size_t {
+        return std_size(std::distance(
+          _class_sizes.begin(), std::ranges::lower_bound(_class_sizes, size)));
+    }
+
+    static auto _chunk_size(const std::size_t size) noexcept -> std::size_t {
+        const auto cls{_class_of(size)};
+        return cls < _class_count ? _class_sizes[cls] : size;
+    }
+
+    // fixed capacity, so that neither the construction nor releasing
+    // a chunk allocates
+    struct _chunk_pool {
+        std::array<byte*, _max_pooled> chunks{};
+        std::size_t count{0U};
+    };
+
+    mutable std::mutex _mutex;
+    std::array<_chunk_pool, _class_count> _pools{};
+    std::size_t _pool_hits{0U};
+    std::size_t _heap_allocations{0U};
+};
+//------------------------------------------------------------------------------
+/// @brief Owning block of memory allocated from the secure_arena.
+///
+/// The block can be used as the destination of derived keys or to hold
+/// MAC keys and passwords, it is wiped when destroyed.
+export class secure_block {
+public:
+    /// @brief Construction of an empty block.
+    secure_block() noexcept = default;
+
+    /// @brief Allocates a zero-initialized block of the specified size.
+    explicit secure_block(const span_size_t size) noexcept
+      : _blk{secure_arena::instance().allocate(size)} {}
+
+    secure_block(secure_block&& temp) noexcept
+      : _blk{std::exchange(temp._blk, memory::block{})} {}
+
+    secure_block(const secure_block&) = delete;
+
+    auto operator=(secure_block&& temp) noexcept -> secure_block& {
+        using std::swap;
+        swap(_blk, temp._blk);
+        return *this;
+    }
+
+    auto operator=(const secure_block&) = delete;
+
+    ~secure_block() noexcept {
+        if(not _blk.empty()) {
+            secure_arena::instance().deallocate(_blk);
+        }
+    }
+
+    /// @brief Indicates if the allocation succeeded.
+    explicit operator bool() const noexcept {
+        return not _blk.empty();
+    }
+
+    /// @brief Returns the size of the block.
+    auto size() const noexcept -> span_size_t {
+        return _blk.size();
+    }
+
+    /// @brief Returns the mutable block.
+    auto block() noexcept -> memory::block {
+        return _blk;
+    }
+
+    /// @brief Returns the const view of the block.
+    auto view() const noexcept -> memory::const_block {
+        return _blk;
+    }
+
+private:
+    memory::block _blk{};
+};
+//------------------------------------------------------------------------------
+/// @brief Standard allocator allocating from the secure_arena.
+export template <typename T>
+class secure_allocator {
+public:
+    using value_type = T;
+
+    secure_allocator() noexcept = default;
+
+    template <typename U>
+    secure_allocator(const secure_allocator<U>&) noexcept {}
+
+    auto allocate(const std::size_t n) -> T* {
+        const auto blk{
+          secure_arena::instance().allocate(span_size(n * sizeof(T)))};
+        if(blk.empty()) {
+            throw std::bad_alloc{};
+        }
+        return reinterpret_cast<T*>(blk.data());
+    }
+
+    void deallocate(T* ptr, const std::size_t n) noexcept {
+        secure_arena::instance().deallocate(
+          {reinterpret_cast<byte*>(ptr), span_size(n * sizeof(T))});
+    }
+
+    template <typename U>
+    auto operator==(const secure_allocator<U>&) const noexcept -> bool {
+        return true;
+    }
+};
+//------------------------------------------------------------------------------
+/// @brief Password kept in the secure_arena.
+/// @see password_callback
+export class secure_password {
+public:
+    /// @brief Copies the specified password into the secure arena.
+    secure_password(const string_view password) noexcept
+      : _storage{span_size(password.size() + 1)} {
+        if(_storage) {
+            std::copy(
+              password.begin(),
+              password.end(),
+              reinterpret_cast<char*>(_storage.block().data()));
+        }
+    }
+
+    /// @brief Returns the password.
+    auto get() const noexcept -> string_view {
+        const auto blk{_storage.view()};
+        return {
+          reinterpret_cast<const char*>(blk.data()),
+          std::max(blk.size() - 1, span_size_t(0))};
+    }
+
+    /// @brief Writes the NUL-terminated password into the OpenSSL buffer.
+    auto operator()(const memory::string_span dst, const bool) const noexcept
+      -> bool {
+        const auto pwd{get()};
+        if(_storage and (pwd.size() < dst.size())) {
+            std::copy(pwd.begin(), pwd.end(), dst.begin());
+            dst[pwd.size()] = '\0';
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief Returns a callback passing this password to OpenSSL.
+    /// @note This object must outlive the returned callback.
+    auto callback() noexcept -> password_callback {
+        return {{construct_from, *this}};
+    }
+
+private:
+    secure_block _storage;
+};
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
@@ -0,0 +1,113 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+module;
+
+#if __has_include(<openssl/crypto.h>)
+#include <openssl/crypto.h>
+
+#define EAGINE_HAS_SSL 1
+#else
+#define EAGINE_HAS_SSL 0
+#endif
+
+module eagine.sslplus;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+auto secure_arena::instance() noexcept -> secure_arena& {
+    // never destroyed, the blocks can be released during static destruction
+    alignas(secure_arena) static std::byte storage[sizeof(secure_arena)];
+    static auto* arena{new(storage) secure_arena{}};
+    return *arena;
+}
+//------------------------------------------------------------------------------
+auto secure_arena::allocate(const span_size_t size) noexcept
+  -> memory::block {
+    if(size <= 0) {
+        return {};
+    }
+    const auto cls{_class_of(std_size(size))};
+    if(cls < _class_count) {
+        const std::lock_guard lock{_mutex};
+        if(auto& pool{_pools[cls]}; pool.count > 0U) {
+            // the chunks are wiped when released
+            auto* chunk{pool.chunks[--pool.count]};
+            ++_pool_hits;
+            return {chunk, size};
+        }
+    }
+#if EAGINE_HAS_SSL
+    if(auto* chunk{static_cast<byte*>(
+         OPENSSL_secure_zalloc(_chunk_size(std_size(size))))}) {
+        const std::lock_guard lock{_mutex};
+        ++_heap_allocations;
+        return {chunk, size};
+    }
+#endif
+    return {};
+}
+//------------------------------------------------------------------------------
+void secure_arena::deallocate([[maybe_unused]] memory::block blk) noexcept {
+    if(blk.empty()) {
+        return;
+    }
+#if EAGINE_HAS_SSL
+    const auto chunk_size{_chunk_size(std_size(blk.size()))};
+    const auto cls{_class_of(std_size(blk.size()))};
+    if(cls < _class_count) {
+        OPENSSL_cleanse(blk.data(), chunk_size);
+        const std::lock_guard lock{_mutex};
+        if(auto& pool{_pools[cls]}; pool.count < _max_pooled) {
+            pool.chunks[pool.count++] = blk.data();
+            return;
+        }
+    }
+    OPENSSL_secure_clear_free(blk.data(), chunk_size);
+#endif
+}
+//------------------------------------------------------------------------------
+auto secure_arena::is_secure(
+  [[maybe_unused]] const memory::const_block blk) const noexcept -> bool {
+#if EAGINE_HAS_SSL
+    return not blk.empty() and CRYPTO_secure_allocated(blk.data());
+#else
+    return false;
+#endif
+}
+//------------------------------------------------------------------------------
+void secure_arena::trim() noexcept {
+    const std::lock_guard lock{_mutex};
+    for(auto& pool : _pools) {
+        for([[maybe_unused]] auto* chunk :
+            std::span{pool.chunks.data(), pool.count}) {
+#if EAGINE_HAS_SSL
+            OPENSSL_secure_free(chunk);
+#endif
+        }
+        pool.count = 0U;
+    }
+}
+//------------------------------------------------------------------------------
+auto secure_arena::stats() const noexcept -> secure_arena_stats {
+    const std::lock_guard lock{_mutex};
+    secure_arena_stats result{
+      .pool_hits = _pool_hits, .heap_allocations = _heap_allocations};
+    for(const auto& pool : _pools) {
+        result.pooled += pool.count;
+    }
+#if EAGINE_HAS_SSL
+    result.secure_heap_used = CRYPTO_secure_used();
+#endif
+    return result;
+}
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
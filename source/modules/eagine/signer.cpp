@@ -0,0 +1,180 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+export module eagine.sslplus:signer;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+import eagine.core.utility;
+import eagine.core.c_api;
+import :api_traits;
+import :object_handle;
+import :api;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+/// @brief Signs data with a key and message digest type bound at construction.
+/// @see basic_data_verifier
+///
+/// The key-specific signing state is initialized only once into a template
+/// context, which is then copied into a work context for each signature.
+/// Pure EdDSA keys (Ed25519, Ed448) are signed in one shot and ignore the
+/// message digest type. Instances are not thread-safe, use one signer per thread.
+export template <typename ApiTraits>
+class basic_data_signer {
+public:
+    basic_data_signer(
+      const basic_ssl_api<ApiTraits>& ssl,
+      const message_digest_type mdtype,
+      const pkey pky) noexcept
+      : _ssl{ssl}
+      , _one_shot{pky and ssl.is_pure_eddsa_key(pky)} {
+        if((mdtype or _one_shot) and pky) {
+            if(ok tmpl{_ssl.new_message_digest()}) {
+                if(_ssl.message_digest_sign_init(
+                     tmpl,
+                     _one_shot ? message_digest_type{} : mdtype,
+                     engine{},
+                     pky)) {
+                    if(ok work{_ssl.new_message_digest()}) {
+                        _template = std::move(tmpl.get());
+                        _work = std::move(work.get());
+                        return;
+                    }
+                }
+                _ssl.delete_message_digest(std::move(tmpl.get()));
+            }
+        }
+    }
+
+    basic_data_signer(basic_data_signer&&) noexcept = default;
+    basic_data_signer(const basic_data_signer&) = delete;
+    auto operator=(basic_data_signer&&) = delete;
+    auto operator=(const basic_data_signer&) = delete;
+
+    ~basic_data_signer() noexcept {
+        if(_work) {
+            _ssl.delete_message_digest(std::move(_work));
+        }
+        if(_template) {
+            _ssl.delete_message_digest(std::move(_template));
+        }
+    }
+
+    /// @brief Indicates if the signing context was successfully initialized.
+    explicit operator bool() const noexcept {
+        return _template and _work;
+    }
+
+    /// @brief Signs the specified data, writes the signature into dst.
+    /// @return The head of dst containing the signature or an empty block.
+    auto sign(const memory::const_block data, memory::block dst) noexcept
+      -> memory::block {
+        if(*this) {
+            if(_ssl.copy_message_digest(_work, _template)) {
+                if(_one_shot) {
+                    size_t size{std_size(dst.size())};
+                    if(_ssl.message_digest_sign(_work, dst, size, data)) {
+                        return head(dst, span_size(size));
+                    }
+                } else if(_ssl.message_digest_sign_update(_work, data)) {
+                    return _ssl.message_digest_sign_final(_work, dst)
+                      .or_default();
+                }
+            }
+        }
+        return {};
+    }
+
+private:
+    const basic_ssl_api<ApiTraits>& _ssl;
+    bool _one_shot{false};
+    owned_message_digest _template{};
+    owned_message_digest _work{};
+};
+//------------------------------------------------------------------------------
+/// @brief Verifies data signatures with a key and message digest type.
+/// @see basic_data_signer
+///
+/// The key-specific verification state is initialized only once into
+/// a template context, which is then copied into a work context for each
+/// verification. Instances are not thread-safe, use one verifier per thread.
+export template <typename ApiTraits>
+class basic_data_verifier {
+public:
+    basic_data_verifier(
+      const basic_ssl_api<ApiTraits>& ssl,
+      const message_digest_type mdtype,
+      const pkey pky) noexcept
+      : _ssl{ssl}
+      , _one_shot{pky and ssl.is_pure_eddsa_key(pky)} {
+        if((mdtype or _one_shot) and pky) {
+            if(ok tmpl{_ssl.new_message_digest()}) {
+                if(_ssl.message_digest_verify_init(
+                     tmpl,
+                     _one_shot ? message_digest_type{} : mdtype,
+                     engine{},
+                     pky)) {
+                    if(ok work{_ssl.new_message_digest()}) {
+                        _template = std::move(tmpl.get());
+                        _work = std::move(work.get());
+                        return;
+                    }
+                }
+                _ssl.delete_message_digest(std::move(tmpl.get()));
+            }
+        }
+    }
+
+    basic_data_verifier(basic_data_verifier&&) noexcept = default;
+    basic_data_verifier(const basic_data_verifier&) = delete;
+    auto operator=(basic_data_verifier&&) = delete;
+    auto operator=(const basic_data_verifier&) = delete;
+
+    ~basic_data_verifier() noexcept {
+        if(_work) {
+            _ssl.delete_message_digest(std::move(_work));
+        }
+        if(_template) {
+            _ssl.delete_message_digest(std::move(_template));
+        }
+    }
+
+    /// @brief Indicates if the verification context was successfully initialized.
+    explicit operator bool() const noexcept {
+        return _template and _work;
+    }
+
+    /// @brief Verifies that sig is a valid signature of the specified data.
+    auto verify(
+      const memory::const_block data,
+      const memory::const_block sig) noexcept -> bool {
+        if(*this) {
+            if(_ssl.copy_message_digest(_work, _template)) {
+                if(_one_shot) {
+                    return bool(_ssl.message_digest_verify(_work, sig, data));
+                }
+                if(_ssl.message_digest_verify_update(_work, data)) {
+                    return bool(_ssl.message_digest_verify_final(_work, sig));
+                }
+            }
+        }
+        return false;
+    }
+
+private:
+    const basic_ssl_api<ApiTraits>& _ssl;
+    bool _one_shot{false};
+    owned_message_digest _template{};
+    owned_message_digest _work{};
+};
+//------------------------------------------------------------------------------
+export using data_signer = basic_data_signer<ssl_api_traits>;
+export using data_verifier = basic_data_verifier<ssl_api_traits>;
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
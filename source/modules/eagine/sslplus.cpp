@@ -15,5 +15,22 @@ export import :object_stack;
 export import :c_api;
 export import :constants;
 export import :api;
+export import :signer;
+export import :key_pool;
+export import :kdf;
+export import :random;
+export import :library_context;
+export import :instrumentation;
+export import :verification;
+export import :conversions;
+export import :crl;
+export import :ocsp;
+export import :subject_alt_names;
+export import :certificate_info;
+export import :pinning;
+export import :issuer_cache;
+export import :key_cache;
+export import :key_export;
+export import :secure_memory;
 export import :resources;
 export import :embedded;
@@ -0,0 +1,227 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+export module eagine.sslplus:subject_alt_names;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+import eagine.core.utility;
+import :object_handle;
+import :object_stack;
+import :conversions;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+/// @brief Enumeration of the supported kinds of general names.
+/// @see general_name_value
+export enum class general_name_kind : std::uint8_t {
+    dns,
+    ip_address,
+    email,
+    uri,
+    other
+};
+
+/// @brief The kind and the raw content of a general name.
+export struct general_name_value {
+    general_name_kind kind{general_name_kind::other};
+    /// @brief The content, IA5 string or 4 / 16 bytes of an IP address.
+    /// @note The block is owned by the general name.
+    memory::const_block data{};
+};
+
+/// @brief Decodes the subject alternative name extension of a certificate.
+/// @return An empty stack if the certificate has no such extension.
+export auto get_x509_subject_alt_names(const x509 cert) noexcept
+  -> object_stack<owned_general_name>;
+
+/// @brief Returns the kind and the raw content of a general name.
+export auto get_general_name_value(const general_name name) noexcept
+  -> general_name_value;
+
+/// @brief Parses a textual IPv4 or IPv6 address into dst.
+/// @return The head of dst containing the 4 or 16 address bytes or empty block.
+export auto parse_ip_address(const string_view text, memory::block dst) noexcept
+  -> memory::block;
+//------------------------------------------------------------------------------
+constexpr auto san_to_lower(const char c) noexcept -> char {
+    return ((c >= 'A') and (c <= 'Z')) ? char(c - 'A' + 'a') : c;
+}
+
+constexpr auto san_iequal(
+  const std::string_view l,
+  const std::string_view r) noexcept -> bool {
+    return std::ranges::equal(l, r, [](const char a, const char b) {
+        return san_to_lower(a) == san_to_lower(b);
+    });
+}
+
+constexpr auto san_strip_dot(std::string_view s) noexcept -> std::string_view {
+    if(s.ends_with('.')) {
+        s.remove_suffix(1);
+    }
+    return s;
+}
+//------------------------------------------------------------------------------
+/// @brief Pre-parsed subject alternative names of a certificate.
+/// @see get_x509_subject_alt_names
+///
+/// The extension is decoded once and the names are stored normalized in
+/// a single buffer, so that the certificate can be matched against many
+/// host names or addresses cheaply. Like X509_check_host with the
+/// X509_CHECK_FLAG_NO_PARTIAL_WILDCARDS and X509_CHECK_FLAG_NEVER_CHECK_SUBJECT
+/// flags, only a whole left-most wildcard label is accepted and the subject
+/// common name is never consulted.
+export class subject_alt_names {
+public:
+    /// @brief Construction of an empty name set.
+    subject_alt_names() noexcept = default;
+
+    /// @brief Construction from the extension of the specified certificate.
+    subject_alt_names(const x509 cert) {
+        const auto names{get_x509_subject_alt_names(cert)};
+        _entries.reserve(static_cast<std::size_t>(names.size()));
+        for(const auto name : names) {
+            const auto value{get_general_name_value(name)};
+            if(value.kind != general_name_kind::other) {
+                _add(value.kind, as_std_view(value.data));
+            }
+        }
+    }
+
+    /// @brief Indicates if there are no names of the supported kinds.
+    auto empty() const noexcept -> bool {
+        return _entries.empty();
+    }
+
+    /// @brief Returns the number of names of the supported kinds.
+    auto size() const noexcept -> span_size_t {
+        return span_size(_entries.size());
+    }
+
+    /// @brief Calls the function with the kind and normalized text of each name.
+    template <typename Function>
+    void for_each(Function func) const {
+        for(const auto& entry : _entries) {
+            func(entry.kind, _text(entry));
+        }
+    }
+
+    /// @brief Indicates if any of the DNS names matches the specified host name.
+    auto matches_host(const string_view host, const bool wildcards = true)
+      const noexcept -> bool {
+        const auto name{san_strip_dot(as_std_view(host))};
+        if(name.empty() or name.starts_with('.')) {
+            return false;
+        }
+        const auto first_dot{name.find('.')};
+        for(const auto& entry : _entries) {
+            if(entry.kind == general_name_kind::dns) {
+                const auto pattern{_text(entry)};
+                if(entry.wildcard) {
+                    // the pattern is stored with the leading '*'
+                    if(
+                      wildcards and (first_dot != std::string_view::npos) and
+                      (first_dot > 0) and
+                      san_iequal(pattern.substr(1), name.substr(first_dot))) {
+                        return true;
+                    }
+                } else if(san_iequal(pattern, name)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /// @brief Indicates if any of the IP addresses matches the specified bytes.
+    auto matches_ip(const memory::const_block address) const noexcept -> bool {
+        const auto addr{as_std_view(address)};
+        return std::ranges::any_of(_entries, [&](const auto& entry) {
+            return (entry.kind == general_name_kind::ip_address) and
+                   (_text(entry) == addr);
+        });
+    }
+
+    /// @brief Indicates if any of the IP addresses matches the textual address.
+    auto matches_ip_text(const string_view address) const noexcept -> bool {
+        std::array<byte, 16> buffer{};
+        if(const auto addr{parse_ip_address(address, cover(buffer))}) {
+            return matches_ip(addr);
+        }
+        return false;
+    }
+
+    /// @brief Indicates if any of the e-mail addresses matches the specified one.
+    /// @note The local part is compared case-sensitively, the domain is not.
+    auto matches_email(const string_view address) const noexcept -> bool {
+        const auto email{as_std_view(address)};
+        const auto at{email.rfind('@')};
+        if(at == std::string_view::npos) {
+            return false;
+        }
+        return std::ranges::any_of(_entries, [&](const auto& entry) {
+            if(entry.kind == general_name_kind::email) {
+                const auto text{_text(entry)};
+                return (text.size() == email.size()) and
+                       (text.substr(0, at) == email.substr(0, at)) and
+                       san_iequal(text.substr(at), email.substr(at));
+            }
+            return false;
+        });
+    }
+
+private:
+    struct entry_info {
+        std::uint32_t offset{0U};
+        std::uint16_t length{0U};
+        general_name_kind kind{general_name_kind::other};
+        bool wildcard{false};
+    };
+
+    auto _text(const entry_info& entry) const noexcept -> std::string_view {
+        return std::string_view{_buffer}.substr(entry.offset, entry.length);
+    }
+
+    void _add(const general_name_kind kind, std::string_view text) {
+        bool wildcard{false};
+        if(kind == general_name_kind::dns) {
+            text = san_strip_dot(text);
+            if(text.starts_with('*')) {
+                // only a whole left-most label with at least two more labels
+                const auto rest{text.substr(1)};
+                if(
+                  not rest.starts_with('.') or
+                  (rest.find('.', 1) == std::string_view::npos) or
+                  (rest.find('*') != std::string_view::npos)) {
+                    return;
+                }
+                wildcard = true;
+            }
+        }
+        if(text.empty() or (text.size() > 0xFFFFU)) {
+            return;
+        }
+        entry_info entry{
+          .offset = static_cast<std::uint32_t>(_buffer.size()),
+          .length = static_cast<std::uint16_t>(text.size()),
+          .kind = kind,
+          .wildcard = wildcard};
+        if(kind == general_name_kind::dns) {
+            std::ranges::transform(text, std::back_inserter(_buffer), san_to_lower);
+        } else {
+            _buffer.append(text);
+        }
+        _entries.push_back(entry);
+    }
+
+    std::string _buffer;
+    std::vector<entry_info> _entries;
+};
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
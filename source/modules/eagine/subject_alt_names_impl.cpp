@@ -0,0 +1,98 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+module;
+
+#if __has_include(<openssl/x509v3.h>)
+#include <openssl/asn1.h>
+#include <openssl/x509.h>
+#include <openssl/x509v3.h>
+
+#define EAGINE_HAS_SSL 1
+#else
+#define EAGINE_HAS_SSL 0
+#endif
+
+module eagine.sslplus;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+auto get_x509_subject_alt_names([[maybe_unused]] const x509 cert) noexcept
+  -> object_stack<owned_general_name> {
+#if EAGINE_HAS_SSL
+    if(cert) {
+        if(auto* names{static_cast<GENERAL_NAMES*>(X509_get_ext_d2i(
+             static_cast<X509*>(cert), NID_subject_alt_name, nullptr, nullptr))}) {
+            return object_stack<owned_general_name>{names};
+        }
+    }
+#endif
+    return {};
+}
+//------------------------------------------------------------------------------
+auto get_general_name_value([[maybe_unused]] const general_name name) noexcept
+  -> general_name_value {
+#if EAGINE_HAS_SSL
+    if(name) {
+        int type{-1};
+        const auto* value{static_cast<const ASN1_STRING*>(GENERAL_NAME_get0_value(
+          static_cast<GENERAL_NAME*>(name), &type))};
+        const auto kind{[type] {
+            switch(type) {
+                case GEN_DNS:
+                    return general_name_kind::dns;
+                case GEN_IPADD:
+                    return general_name_kind::ip_address;
+                case GEN_EMAIL:
+                    return general_name_kind::email;
+                case GEN_URI:
+                    return general_name_kind::uri;
+                default:
+                    return general_name_kind::other;
+            }
+        }()};
+        if(value and (kind != general_name_kind::other)) {
+            return {
+              .kind = kind,
+              .data = {
+                ASN1_STRING_get0_data(value),
+                span_size(ASN1_STRING_length(value))}};
+        }
+    }
+#endif
+    return {};
+}
+//------------------------------------------------------------------------------
+auto parse_ip_address(
+  [[maybe_unused]] const string_view text,
+  [[maybe_unused]] memory::block dst) noexcept -> memory::block {
+#if EAGINE_HAS_SSL
+    // a2i_IPADDRESS requires a null-terminated string
+    std::array<char, 64> buffer{};
+    if((text.size() > 0) and (std_size(text.size()) < buffer.size())) {
+        std::copy(text.begin(), text.end(), buffer.begin());
+        if(auto* address{a2i_IPADDRESS(buffer.data())}) {
+            const auto size{span_size(ASN1_STRING_length(address))};
+            const bool fits{size <= dst.size()};
+            if(fits) {
+                std::copy_n(ASN1_STRING_get0_data(address), size, dst.begin());
+            }
+            ASN1_OCTET_STRING_free(address);
+            if(fits) {
+                return head(dst, size);
+            }
+        }
+    }
+#endif
+    return {};
+}
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
@@ -0,0 +1,688 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+export module eagine.sslplus:verification;
+
+import std;
+import eagine.core.types;
+import eagine.core.memory;
+import eagine.core.utility;
+import eagine.core.c_api;
+import :api_traits;
+import :object_handle;
+import :object_stack;
+import :api;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+/// @brief Returns the chain built by a successful verification.
+/// @note The returned stack owns references to the certificates in the chain.
+export auto get_verified_chain(const x509_store_ctx vrfy_ctx) noexcept
+  -> object_stack<owned_x509>;
+//------------------------------------------------------------------------------
+/// @brief Parameters of certificate chain verification.
+/// @see basic_chain_verifier
+export struct chain_verification_options {
+    /// @brief The required X509 purpose, zero means the purpose is not checked.
+    /// @see basic_ssl_constants::x509_purpose_ssl_server
+    int purpose{0};
+    /// @brief The time at which the chain is verified, current time if empty.
+    std::optional<std::chrono::system_clock::time_point> time{};
+    /// @brief The maximum chain depth, negative means the store's default.
+    int depth{-1};
+    /// @brief Additional X509_V_FLAG_* verification flags.
+    unsigned long flags{0UL};
+    /// @brief Indicates if the verified chain should be returned.
+    bool return_chain{true};
+    /// @brief Optional callback applying custom policies during chain building.
+    /// @note The bulk verifier invokes the callback concurrently.
+    verify_callback* callback{nullptr};
+};
+//------------------------------------------------------------------------------
+/// @brief Result of certificate chain verification.
+/// @see basic_chain_verifier
+export struct chain_verification_result {
+    /// @brief The verified chain, from the leaf to the trust anchor.
+    object_stack<owned_x509> chain;
+    /// @brief The X509_V_ERR_* code of the verification failure.
+    int error{0};
+    /// @brief The depth in the chain at which the verification failed.
+    int error_depth{-1};
+    bool verified{false};
+
+    explicit operator bool() const noexcept {
+        return verified;
+    }
+};
+//------------------------------------------------------------------------------
+/// @brief Pool of reusable X509 store contexts.
+/// @see basic_chain_verifier
+///
+/// The contexts are cleaned up when returned, which keeps their allocations
+/// for the next verification. The pool is thread-safe.
+export template <typename ApiTraits>
+class basic_x509_store_ctx_pool {
+public:
+    basic_x509_store_ctx_pool(
+      const basic_ssl_api<ApiTraits>& ssl,
+      const span_size_t max_size = 64) noexcept
+      : _ssl{ssl}
+      , _max_size{std_size(max_size)} {}
+
+    basic_x509_store_ctx_pool(basic_x509_store_ctx_pool&&) = delete;
+    basic_x509_store_ctx_pool(const basic_x509_store_ctx_pool&) = delete;
+    auto operator=(basic_x509_store_ctx_pool&&) = delete;
+    auto operator=(const basic_x509_store_ctx_pool&) = delete;
+
+    ~basic_x509_store_ctx_pool() noexcept {
+        for(auto& vrfy_ctx : _contexts) {
+            _ssl.delete_x509_store_ctx(std::move(vrfy_ctx));
+        }
+    }
+
+    /// @brief Returns a pooled or a new store context.
+    auto acquire() noexcept -> owned_x509_store_ctx {
+        {
+            const std::unique_lock lock{_mutex};
+            if(not _contexts.empty()) {
+                owned_x509_store_ctx vrfy_ctx{std::move(_contexts.back())};
+                _contexts.pop_back();
+                return vrfy_ctx;
+            }
+        }
+        if(ok vrfy_ctx{_ssl.new_x509_store_ctx()}) {
+            return std::move(vrfy_ctx.get());
+        }
+        return {};
+    }
+
+    /// @brief Cleans up and returns the store context into the pool.
+    void release(owned_x509_store_ctx vrfy_ctx) noexcept {
+        if(vrfy_ctx) {
+            _ssl.cleanup_x509_store_ctx(vrfy_ctx);
+            const std::unique_lock lock{_mutex};
+            if(_contexts.size() < _max_size) {
+                _contexts.push_back(std::move(vrfy_ctx));
+                return;
+            }
+        }
+        if(vrfy_ctx) {
+            _ssl.delete_x509_store_ctx(std::move(vrfy_ctx));
+        }
+    }
+
+private:
+    const basic_ssl_api<ApiTraits>& _ssl;
+    const std::size_t _max_size;
+    std::mutex _mutex;
+    std::vector<owned_x509_store_ctx> _contexts;
+};
+//------------------------------------------------------------------------------
+/// @brief Verifies certificate chains with caller-supplied intermediates.
+/// @see basic_x509_store_ctx_pool
+///
+/// The store contexts are drawn from a pool instead of being allocated for
+/// each verification. The verifier is thread-safe if the store is not
+/// modified concurrently.
+export template <typename ApiTraits>
+class basic_chain_verifier {
+public:
+    basic_chain_verifier(
+      const basic_ssl_api<ApiTraits>& ssl,
+      const span_size_t pool_size = 64) noexcept
+      : _ssl{ssl}
+      , _pool{ssl, pool_size} {}
+
+    /// @brief Verifies the leaf certificate, with untrusted intermediates.
+    auto verify_chain(
+      const x509_store store,
+      const x509 leaf,
+      const object_stack<x509>& intermediates,
+      const chain_verification_options& opts = {}) noexcept
+      -> chain_verification_result {
+        chain_verification_result result;
+        if(auto vrfy_ctx{_pool.acquire()}) {
+            if(_ssl.init_x509_store_ctx(vrfy_ctx, store, leaf, intermediates)) {
+                _verify(vrfy_ctx, opts, result);
+            }
+            _pool.release(std::move(vrfy_ctx));
+        }
+        return result;
+    }
+
+    /// @brief Verifies the leaf certificate against the specified trust anchors.
+    /// @see basic_issuer_cache
+    auto verify_chain(
+      const x509_store store,
+      const x509 leaf,
+      const object_stack<x509>& intermediates,
+      const object_stack<owned_x509>& trusted,
+      const chain_verification_options& opts = {}) noexcept
+      -> chain_verification_result {
+        chain_verification_result result;
+        if(auto vrfy_ctx{_pool.acquire()}) {
+            if(_ssl.init_x509_store_ctx(vrfy_ctx, store, leaf, intermediates)) {
+                _ssl.set_x509_store_trusted_stack(vrfy_ctx, trusted);
+                _verify(vrfy_ctx, opts, result);
+            }
+            _pool.release(std::move(vrfy_ctx));
+        }
+        return result;
+    }
+
+    /// @brief Verifies the leaf certificate issued directly by a trusted one.
+    auto verify_chain(
+      const x509_store store,
+      const x509 leaf,
+      const chain_verification_options& opts = {}) noexcept
+      -> chain_verification_result {
+        chain_verification_result result;
+        if(auto vrfy_ctx{_pool.acquire()}) {
+            if(_ssl.init_x509_store_ctx(vrfy_ctx, store, leaf)) {
+                _verify(vrfy_ctx, opts, result);
+            }
+            _pool.release(std::move(vrfy_ctx));
+        }
+        return result;
+    }
+
+private:
+    void _verify(
+      const x509_store_ctx vrfy_ctx,
+      const chain_verification_options& opts,
+      chain_verification_result& result) noexcept {
+        if(opts.purpose != 0) {
+            _ssl.set_x509_store_ctx_purpose(vrfy_ctx, opts.purpose);
+        }
+        if(opts.flags != 0UL) {
+            _ssl.set_x509_store_ctx_flags(vrfy_ctx, opts.flags);
+        }
+        if(opts.time) {
+            _ssl.set_x509_store_ctx_time(
+              vrfy_ctx, 0UL, std::chrono::system_clock::to_time_t(*opts.time));
+        }
+        if(opts.depth >= 0) {
+            _ssl.set_x509_store_ctx_depth(vrfy_ctx, opts.depth);
+        }
+        if(opts.callback) {
+            _ssl.set_verify_callback(vrfy_ctx, *opts.callback);
+        }
+        if(_ssl.x509_verify_certificate(vrfy_ctx)) {
+            if(opts.return_chain) {
+                result.chain = get_verified_chain(vrfy_ctx);
+            }
+            result.verified = true;
+        } else {
+            result.error = _ssl.get_x509_store_ctx_error(vrfy_ctx).value_or(0);
+            result.error_depth =
+              _ssl.get_x509_store_ctx_error_depth(vrfy_ctx).value_or(-1);
+        }
+    }
+
+    const basic_ssl_api<ApiTraits>& _ssl;
+    basic_x509_store_ctx_pool<ApiTraits> _pool;
+};
+//------------------------------------------------------------------------------
+/// @brief Parameters of bulk certificate verification.
+/// @see basic_bulk_verifier
+export struct bulk_verification_options {
+    /// @brief Parameters applied to the verification of each certificate.
+    chain_verification_options chain{};
+    /// @brief The number of worker threads, zero means hardware concurrency.
+    span_size_t threads{0};
+    /// @brief The number of certificates handed to a worker at once.
+    span_size_t batch_size{64};
+    /// @brief Use CA certificates from the input as untrusted intermediates.
+    bool collect_intermediates{true};
+};
+//------------------------------------------------------------------------------
+/// @brief Result of the verification of one certificate in a bulk.
+/// @see basic_bulk_verifier
+export struct bulk_verification_result {
+    /// @brief The position of the certificate in the input sequence.
+    span_size_t index{0};
+    /// @brief The X509_V_ERR_* code of the verification failure.
+    int error{0};
+    /// @brief The depth in the chain at which the verification failed.
+    int error_depth{-1};
+    /// @brief Indicates if the certificate was parsed successfully.
+    bool parsed{false};
+    bool verified{false};
+
+    explicit operator bool() const noexcept {
+        return verified;
+    }
+};
+//------------------------------------------------------------------------------
+/// @brief Verifies large sequences of certificates on a pool of threads.
+/// @see basic_chain_verifier
+///
+/// The certificates are read from the input on the calling thread, parsed
+/// from DER or PEM and verified in batches by the worker threads against
+/// a single shared store. CA certificates found in the input are collected
+/// into a deduplicated set of untrusted intermediates, which is kept across
+/// calls to verify. Certificates failing due to a missing issuer are retried
+/// once the whole input was seen, if new intermediates were found since.
+export template <typename ApiTraits>
+class basic_bulk_verifier {
+public:
+    basic_bulk_verifier(
+      const basic_ssl_api<ApiTraits>& ssl,
+      const x509_store store,
+      const bulk_verification_options& opts = {}) noexcept
+      : _ssl{ssl}
+      , _threads{_thread_count(opts)}
+      , _batch_size{std::max(opts.batch_size, span_size_t(1))}
+      , _collect_intermediates{opts.collect_intermediates}
+      , _chain_opts{opts.chain}
+      , _verifier{ssl, _threads} {
+        _chain_opts.return_chain = false;
+        if(ok copy{_ssl.copy_x509_store(store)}) {
+            _store = std::move(copy.get());
+        }
+    }
+
+    basic_bulk_verifier(basic_bulk_verifier&&) = delete;
+    basic_bulk_verifier(const basic_bulk_verifier&) = delete;
+    auto operator=(basic_bulk_verifier&&) = delete;
+    auto operator=(const basic_bulk_verifier&) = delete;
+
+    ~basic_bulk_verifier() noexcept {
+        _intermediates.reset();
+        for(auto& entry : _issuers) {
+            _ssl.delete_x509(std::move(entry.second));
+        }
+        if(_store) {
+            _ssl.delete_x509_store(std::move(_store));
+        }
+    }
+
+    /// @brief Returns the number of distinct intermediates collected so far.
+    auto intermediate_count() const noexcept -> span_size_t {
+        const std::lock_guard lock{_issuers_mutex};
+        return span_size(_issuers.size());
+    }
+
+    /// @brief Verifies the certificates in the specified input sequence.
+    /// @param on_result called on this thread for each input certificate.
+    /// @return The number of certificates read from the input.
+    ///
+    /// The input elements must be convertible to memory::const_block
+    /// containing a DER or PEM encoded certificate. The results are passed
+    /// in the order of completion, not in the input order. The callback
+    /// must not throw. If processing a batch on a worker thread throws, for
+    /// example std::bad_alloc, the exception is rethrown on this thread.
+    template <typename Iter, typename Sentinel, typename Function>
+    auto verify(Iter pos, const Sentinel end, Function on_result)
+      -> span_size_t {
+        _session s;
+        // stops and joins the workers also if the input or callback throws
+        _worker_pool workers{*this, s};
+        workers.threads.reserve(std_size(_threads));
+        for(span_size_t t = 0; t < _threads; ++t) {
+            workers.threads.emplace_back([this, &s] { _work(s); });
+        }
+
+        span_size_t count{0};
+        _batch batch{};
+        for(; pos != end; ++pos) {
+            batch.append(*pos);
+            if(++count % _batch_size == 0) {
+                _submit(s, std::exchange(batch, {.first = count}), on_result);
+            }
+        }
+        if(not batch.empty()) {
+            _submit(s, std::move(batch), on_result);
+        }
+        _wait_idle(s, on_result);
+
+        std::vector<_item> deferred;
+        {
+            const std::unique_lock lock{s.mutex};
+            deferred.swap(s.deferred);
+        }
+        _batch retry{};
+        for(auto& item : deferred) {
+            retry.retried.push_back(std::move(item));
+            if(span_size(retry.retried.size()) >= _batch_size) {
+                _submit(s, std::exchange(retry, {}), on_result);
+            }
+        }
+        if(not retry.empty()) {
+            _submit(s, std::move(retry), on_result);
+        }
+        _wait_idle(s, on_result);
+        return count;
+    }
+
+    /// @brief Verifies the certificates in the specified input range.
+    template <typename Range, typename Function>
+    auto verify(const Range& certs, Function on_result) -> span_size_t {
+        return verify(std::begin(certs), std::end(certs), std::move(on_result));
+    }
+
+private:
+    struct _item {
+        span_size_t index{0};
+        owned_x509 cert{};
+        x509 view{};
+        int error{0};
+        int error_depth{-1};
+        std::size_t generation{0U};
+    };
+
+    struct _batch {
+        span_size_t first{0};
+        std::vector<byte> data{};
+        std::vector<span_size_t> ends{};
+        std::vector<_item> retried{};
+
+        void append(const memory::const_block blk) {
+            data.insert(data.end(), blk.begin(), blk.end());
+            ends.push_back(span_size(data.size()));
+        }
+
+        auto empty() const noexcept -> bool {
+            return ends.empty() and retried.empty();
+        }
+    };
+
+    struct _session {
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::deque<_batch> batches;
+        std::vector<bulk_verification_result> results;
+        std::vector<_item> deferred;
+        std::exception_ptr error{};
+        span_size_t busy{0};
+        bool done{false};
+    };
+
+    struct _worker_pool {
+        basic_bulk_verifier& parent;
+        _session& s;
+        std::vector<std::thread> threads{};
+
+        ~_worker_pool() noexcept {
+            {
+                const std::unique_lock lock{s.mutex};
+                s.done = true;
+            }
+            s.changed.notify_all();
+            for(auto& thread : threads) {
+                thread.join();
+            }
+            // not empty only if verify was interrupted by an exception
+            parent._release(s.deferred);
+        }
+    };
+
+    // immutable, so that the workers can verify without holding a lock
+    struct _intermediates_snapshot {
+        object_stack<x509> certs;
+        std::size_t generation{0U};
+    };
+
+    static auto _thread_count(const bulk_verification_options& opts) noexcept
+      -> span_size_t {
+        if(opts.threads > 0) {
+            return opts.threads;
+        }
+        return span_size(std::max(std::thread::hardware_concurrency(), 1U));
+    }
+
+    template <typename Function>
+    void _deliver(
+      _session& s,
+      std::unique_lock<std::mutex>& lock,
+      Function& on_result) {
+        if(s.error) {
+            std::rethrow_exception(s.error);
+        }
+        if(not s.results.empty()) {
+            std::vector<bulk_verification_result> results;
+            results.swap(s.results);
+            lock.unlock();
+            for(const auto& result : results) {
+                on_result(result);
+            }
+            lock.lock();
+        }
+    }
+
+    template <typename Function>
+    void _submit(_session& s, _batch batch, Function& on_result) {
+        std::unique_lock lock{s.mutex};
+        while(span_size(s.batches.size()) >= 2 * _threads) {
+            s.changed.wait(lock);
+            _deliver(s, lock, on_result);
+        }
+        s.batches.push_back(std::move(batch));
+        lock.unlock();
+        s.changed.notify_all();
+    }
+
+    template <typename Function>
+    void _wait_idle(_session& s, Function& on_result) {
+        std::unique_lock lock{s.mutex};
+        while(not s.batches.empty() or (s.busy > 0)) {
+            s.changed.wait(lock);
+            _deliver(s, lock, on_result);
+        }
+        _deliver(s, lock, on_result);
+    }
+
+    void _work(_session& s) noexcept {
+        std::unique_lock lock{s.mutex};
+        while(true) {
+            s.changed.wait(
+              lock, [&] { return s.done or not s.batches.empty(); });
+            if(s.batches.empty()) {
+                return;
+            }
+            _batch batch{std::move(s.batches.front())};
+            s.batches.pop_front();
+            ++s.busy;
+            lock.unlock();
+            s.changed.notify_all();
+
+            std::vector<bulk_verification_result> results;
+            std::vector<_item> deferred;
+            std::exception_ptr error{};
+            try {
+                _process(batch, results, deferred);
+            } catch(...) {
+                error = std::current_exception();
+            }
+
+            lock.lock();
+            try {
+                if(not error) {
+                    s.results.insert(
+                      s.results.end(), results.begin(), results.end());
+                    for(auto& item : deferred) {
+                        s.deferred.push_back(std::move(item));
+                    }
+                }
+            } catch(...) {
+                error = std::current_exception();
+            }
+            // the exception cannot leave the thread, verify rethrows it
+            if(error and not s.error) {
+                s.error = error;
+            }
+            _release(deferred);
+            --s.busy;
+            s.changed.notify_all();
+        }
+    }
+
+    // deletes the certificates still owned by the items
+    void _release(std::vector<_item>& items) const noexcept {
+        for(auto& item : items) {
+            if(item.cert) {
+                _ssl.delete_x509(std::move(item.cert));
+            }
+        }
+    }
+
+    auto _parse(const memory::const_block blk) const noexcept -> owned_x509 {
+        if(not blk.empty()) {
+            // DER encoding starts with an ASN.1 SEQUENCE tag
+            if(blk.front() == 0x30U) {
+                if(ok cert{_ssl.parse_der_x509(blk)}) {
+                    return std::move(cert.get());
+                }
+            } else if(ok cert{_ssl.parse_x509(blk)}) {
+                return std::move(cert.get());
+            }
+        }
+        return {};
+    }
+
+    auto _current_intermediates() const noexcept
+      -> std::shared_ptr<const _intermediates_snapshot> {
+        const std::lock_guard lock{_issuers_mutex};
+        return _intermediates;
+    }
+
+    void _collect_intermediates_from(std::vector<_item>& items) {
+        std::vector<std::pair<unsigned long, _item*>> cas;
+        for(auto& item : items) {
+            if(_ssl.check_x509_ca(item.view).value_or(0) != 0) {
+                cas.emplace_back(
+                  _ssl.get_x509_subject_name_hash(item.view).value_or(0UL),
+                  &item);
+            }
+        }
+        if(cas.empty()) {
+            return;
+        }
+
+        const std::lock_guard lock{_issuers_mutex};
+        std::shared_ptr<_intermediates_snapshot> next;
+        for(auto [hash, item] : cas) {
+            auto [pos, end] = _issuers.equal_range(hash);
+            for(; pos != end; ++pos) {
+                if(_ssl.compare_x509(pos->second, item->view).value_or(-1) == 0) {
+                    break;
+                }
+            }
+            if(pos != end) {
+                continue;
+            }
+            if(not next) {
+                next = std::make_shared<_intermediates_snapshot>();
+                next->certs.push_all(_intermediates->certs);
+                next->generation = _intermediates->generation + 1U;
+            }
+            next->certs.push(item->view);
+            _issuers.emplace(hash, std::move(item->cert));
+        }
+        if(next) {
+            _intermediates = std::move(next);
+        }
+    }
+
+    static auto _is_missing_issuer(const int error) noexcept -> bool {
+        using ssl = basic_ssl_api<ApiTraits>;
+        return (error == ssl::x509_v_err_unable_to_get_issuer_cert) or
+               (error == ssl::x509_v_err_unable_to_get_issuer_cert_locally);
+    }
+
+    void _verify(
+      const _intermediates_snapshot& intermediates,
+      _item& item,
+      const bool retried,
+      std::vector<bulk_verification_result>& results,
+      std::vector<_item>& deferred) {
+        bulk_verification_result result{.index = item.index, .parsed = true};
+        if(retried and (item.generation == intermediates.generation)) {
+            result.error = item.error;
+            result.error_depth = item.error_depth;
+        } else {
+            const auto verified{_verifier.verify_chain(
+              _store, item.view, intermediates.certs, _chain_opts)};
+            if(verified) {
+                result.verified = true;
+            } else if(not retried and _is_missing_issuer(verified.error)) {
+                item.error = verified.error;
+                item.error_depth = verified.error_depth;
+                item.generation = intermediates.generation;
+                deferred.push_back(std::move(item));
+                return;
+            } else {
+                result.error = verified.error;
+                result.error_depth = verified.error_depth;
+            }
+        }
+        if(item.cert) {
+            _ssl.delete_x509(std::move(item.cert));
+        }
+        results.push_back(result);
+    }
+
+    void _process(
+      _batch& batch,
+      std::vector<bulk_verification_result>& results,
+      std::vector<_item>& deferred) {
+        std::vector<_item> items;
+        try {
+            items.reserve(batch.ends.size());
+            span_size_t begin{0};
+            span_size_t index{batch.first};
+            for(const auto end : batch.ends) {
+                if(auto cert{_parse(memory::const_block{
+                     batch.data.data() + begin, end - begin})}) {
+                    const x509 view{cert};
+                    items.push_back(
+                      {.index = index, .cert = std::move(cert), .view = view});
+                } else {
+                    results.push_back({.index = index});
+                }
+                begin = end;
+                ++index;
+            }
+
+            if(_collect_intermediates) {
+                _collect_intermediates_from(items);
+            }
+
+            // the whole batch is verified without locking the intermediates
+            const auto intermediates{_current_intermediates()};
+            for(auto& item : items) {
+                _verify(*intermediates, item, false, results, deferred);
+            }
+            for(auto& item : batch.retried) {
+                _verify(*intermediates, item, true, results, deferred);
+            }
+        } catch(...) {
+            // the certificates which were not verified yet
+            _release(items);
+            _release(batch.retried);
+            throw;
+        }
+    }
+
+    const basic_ssl_api<ApiTraits>& _ssl;
+    const span_size_t _threads;
+    const span_size_t _batch_size;
+    const bool _collect_intermediates;
+    chain_verification_options _chain_opts;
+    basic_chain_verifier<ApiTraits> _verifier;
+    owned_x509_store _store{};
+    mutable std::mutex _issuers_mutex;
+    std::unordered_multimap<unsigned long, owned_x509> _issuers;
+    std::shared_ptr<const _intermediates_snapshot> _intermediates{
+      std::make_shared<const _intermediates_snapshot>()};
+};
+//------------------------------------------------------------------------------
+export using x509_store_ctx_pool = basic_x509_store_ctx_pool<ssl_api_traits>;
+export using chain_verifier = basic_chain_verifier<ssl_api_traits>;
+export using bulk_verifier = basic_bulk_verifier<ssl_api_traits>;
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus
@@ -0,0 +1,35 @@
+/// @file
+///
+/// Copyright Matus Chochlik.
+/// Distributed under the Boost Software License, Version 1.0.
+/// See accompanying file LICENSE_1_0.txt or copy at
+/// https://www.boost.org/LICENSE_1_0.txt
+///
+module;
+
+#if __has_include(<openssl/x509_vfy.h>)
+#include <openssl/x509_vfy.h>
+
+#define EAGINE_HAS_SSL 1
+#else
+#define EAGINE_HAS_SSL 0
+#endif
+
+module eagine.sslplus;
+
+namespace eagine::sslplus {
+//------------------------------------------------------------------------------
+auto get_verified_chain(const x509_store_ctx vrfy_ctx) noexcept
+  -> object_stack<owned_x509> {
+#if EAGINE_HAS_SSL
+    if(vrfy_ctx) {
+        if(auto* chain{X509_STORE_CTX_get1_chain(
+             static_cast<X509_STORE_CTX*>(vrfy_ctx))}) {
+            return object_stack<owned_x509>{chain};
+        }
+    }
+#endif
+    return {};
+}
+//------------------------------------------------------------------------------
+} // namespace eagine::sslplus